@@ -2182,7 +2182,7 @@ class DumperBase:
             self.put('addrstep="0x%x",' % innerSize)
             self.put('arrayencoding="%s",' % enc)
             if n > maxNumChild:
-                self.put('childrenelided="%s",' % n) # FIXME: Act on that in frontend
+                self.put('childrenelided="%s",' % n) # Reported as "<%n more items>".
                 n = maxNumChild
             self.put('arraydata="')
             self.put(self.readMemory(addrBase, n * innerSize))
@@ -132,6 +132,58 @@ void Lexer::scan(Token *tok)
     tok->f.utf16chars = _currentCharUtf16 - _tokenStartUtf16;
 }
 
+enum {
+    ClassIdentifierChar = 1 << 0,    // [a-zA-Z0-9_$]
+    ClassHorizontalSpace = 1 << 1,   // isspace() except '\n'
+    ClassCommentBodyChar = 1 << 2,   // C comment bytes with no special handling
+    ClassCppCommentBodyChar = 1 << 3 // C++ comment bytes with no special handling
+};
+
+struct CharClassTable
+{
+    unsigned char flags[256];
+
+    CharClassTable()
+    {
+        for (int c = 0; c < 256; ++c)
+            flags[c] = 0;
+        for (int c = 1; c < 128; ++c) {
+            if (std::isalnum(c) || c == '_' || c == '$')
+                flags[c] |= ClassIdentifierChar;
+            if (std::isspace(c) && c != '\n')
+                flags[c] |= ClassHorizontalSpace;
+            if (c != '\n' && c != '*')
+                flags[c] |= ClassCommentBodyChar;
+            if (c != '\n' && c != '\\')
+                flags[c] |= ClassCppCommentBodyChar;
+        }
+    }
+};
+
+static const CharClassTable charClasses;
+
+/// Skips a run of ASCII characters matching \a charClassFlags. For these
+/// characters yyinp() reduces to advancing the source pointer and the UTF-16
+/// counter, so whole runs - identifiers, indentation, comment prose - can be
+/// skipped in one tight loop over the classification table. NUL, '\n' and
+/// bytes of multi-byte code points are never part of a class; the caller
+/// keeps going through yyinp() for those.
+void Lexer::skipAsciiCharRun(unsigned char charClassFlags)
+{
+    const char *cursor = _currentChar;
+    while (charClasses.flags[(unsigned char)*cursor] & charClassFlags)
+        ++cursor;
+    if (cursor == _currentChar)
+        return;
+    _currentCharUtf16 += unsigned(cursor - _currentChar);
+    _currentChar = cursor;
+    _yychar = (unsigned char)*cursor;
+    // Advancing onto a newline must record the line start, exactly as the
+    // yyinp() consuming the last character of the run would have.
+    if (CPLUSPLUS_UNLIKELY(_yychar == '\n'))
+        pushLineStartOffset();
+}
+
 static bool isRawStringLiteral(unsigned char kind)
 {
     return kind >= T_FIRST_RAW_STRING_LITERAL
@@ -158,10 +210,11 @@ void Lexer::scan_helper(Token *tok)
                 s._newlineExpected = false;
             else if (!isMultiLineToken(s._tokenKind))
                 _state = 0;
+            yyinp();
         } else {
             tok->f.whitespace = true;
+            skipAsciiCharRun(ClassHorizontalSpace);
         }
-        yyinp();
     }
 
     if (! _translationUnit)
@@ -186,9 +239,11 @@ void Lexer::scan_helper(Token *tok)
         const int originalKind = s._tokenKind;
 
         while (_yychar) {
-            if (_yychar != '*')
-                yyinp();
-            else {
+            if (_yychar != '*') {
+                skipAsciiCharRun(ClassCommentBodyChar);
+                if (_yychar && _yychar != '*')
+                    yyinp(); // '\n' or a byte of a multi-byte code point
+            } else {
                 yyinp();
                 if (_yychar == '/') {
                     yyinp();
@@ -479,7 +534,9 @@ void Lexer::scan_helper(Token *tok)
 
             while (_yychar) {
                 if (_yychar != '*') {
-                    yyinp();
+                    skipAsciiCharRun(ClassCommentBodyChar);
+                    if (_yychar && _yychar != '*')
+                        yyinp(); // '\n' or a byte of a multi-byte code point
                 } else {
                     yyinp();
                     if (_yychar == '/')
@@ -1039,8 +1096,10 @@ void Lexer::scanPreprocessorNumber(Token *tok, bool dotAlreadySkipped)
 void Lexer::scanIdentifier(Token *tok, unsigned extraProcessedChars)
 {
     const char *yytext = _currentChar - 1 - extraProcessedChars;
-    while (std::isalnum(_yychar) || _yychar == '_' || _yychar == '$'
-            || isByteOfMultiByteCodePoint(_yychar)) {
+    for (;;) {
+        skipAsciiCharRun(ClassIdentifierChar);
+        if (!isByteOfMultiByteCodePoint(_yychar))
+            break;
         yyinp();
     }
     int yylen = _currentChar - yytext;
@@ -1083,9 +1142,12 @@ void Lexer::scanBackslash(Kind type)
 void Lexer::scanCppComment(Kind type)
 {
     while (_yychar && _yychar != '\n') {
-        if (_yychar == '\\')
+        if (_yychar == '\\') {
             scanBackslash(type);
-        else if (_yychar)
-            yyinp();
+        } else {
+            skipAsciiCharRun(ClassCppCommentBodyChar);
+            if (_yychar && _yychar != '\n' && _yychar != '\\')
+                yyinp(); // a byte of a multi-byte code point
+        }
     }
 }
@@ -107,6 +107,7 @@ private:
     void scanIdentifier(Token *tok, unsigned extraProcessedChars = 0);
     void scanBackslash(Kind type);
     void scanCppComment(Kind type);
+    void skipAsciiCharRun(unsigned char charClassFlags);
 
     static bool isByteOfMultiByteCodePoint(unsigned char byte)
     { return byte & 0x80; } // Check if most significant bit is set
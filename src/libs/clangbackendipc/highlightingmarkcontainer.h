@@ -28,8 +28,10 @@
 #include "clangbackendipc_global.h"
 
 #include <QDataStream>
+#include <QVector>
 
 #include <iosfwd>
+#include <type_traits>
 
 namespace ClangBackEnd {
 
@@ -115,6 +117,35 @@ private:
     HighlightingTypes types_;
 };
 
+// A translation unit easily produces a hundred thousand highlighting marks,
+// which makes streaming them one field at a time the dominant cost of an
+// annotation update. The container is a flat record without heap members,
+// and both ends of the connection are built from this very header, so the
+// whole vector can go over the wire as one block of raw bytes.
+static_assert(std::is_standard_layout<HighlightingMarkContainer>::value,
+              "HighlightingMarkContainer must be usable with writeRawData()");
+
+inline QDataStream &operator<<(QDataStream &out, const QVector<HighlightingMarkContainer> &containers)
+{
+    out << quint32(containers.size());
+    out.writeRawData(reinterpret_cast<const char*>(containers.constData()),
+                     containers.size() * int(sizeof(HighlightingMarkContainer)));
+
+    return out;
+}
+
+inline QDataStream &operator>>(QDataStream &in, QVector<HighlightingMarkContainer> &containers)
+{
+    quint32 size;
+    in >> size;
+
+    containers.resize(size);
+    in.readRawData(reinterpret_cast<char*>(containers.data()),
+                   int(size * sizeof(HighlightingMarkContainer)));
+
+    return in;
+}
+
 inline QDataStream &operator<<(QDataStream &out, HighlightingType highlightingType)
 {
     out << static_cast<const quint8>(highlightingType);
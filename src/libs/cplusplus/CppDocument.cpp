@@ -764,6 +764,7 @@ Snapshot::const_iterator Snapshot::find(const Utils::FileName &fileName) const
 void Snapshot::remove(const Utils::FileName &fileName)
 {
     _documents.remove(fileName);
+    m_deps.scheduleUpdate(fileName);
 }
 
 bool Snapshot::contains(const Utils::FileName &fileName) const
@@ -775,7 +776,7 @@ void Snapshot::insert(Document::Ptr doc)
 {
     if (doc) {
         _documents.insert(Utils::FileName::fromString(doc->fileName()), doc);
-        m_deps.files.clear(); // Will trigger re-build when accessed.
+        m_deps.scheduleUpdate(Utils::FileName::fromString(doc->fileName()));
     }
 }
 
@@ -866,8 +867,7 @@ Utils::FileNameList Snapshot::filesDependingOn(const Utils::FileName &fileName)
 
 void Snapshot::updateDependencyTable() const
 {
-    if (m_deps.files.isEmpty())
-        m_deps.build(*this);
+    m_deps.update(*this);
 }
 
 bool Snapshot::operator==(const Snapshot &other) const
@@ -38,6 +38,9 @@ Utils::FileNameList DependencyTable::filesDependingOn(const Utils::FileName &fil
         return deps;
 
     for (int i = 0; i < files.size(); ++i) {
+        if (files.at(i).isEmpty())
+            continue; // Row of a document that was removed from the snapshot.
+
         const QBitArray &bits = includeMap.at(i);
 
         if (bits.testBit(index))
@@ -47,12 +50,120 @@ Utils::FileNameList DependencyTable::filesDependingOn(const Utils::FileName &fil
     return deps;
 }
 
+void DependencyTable::scheduleUpdate(const Utils::FileName &fileName)
+{
+    pendingFiles.insert(fileName);
+}
+
+void DependencyTable::update(const Snapshot &snapshot)
+{
+    // An incremental pass touches the pending rows plus their (transitive)
+    // includers. Once too many documents changed, a full rebuild is cheaper
+    // than patching most of the table row by row.
+    if (files.isEmpty() || pendingFiles.size() * 4 >= qMax(1, snapshot.size()))
+        build(snapshot);
+    else if (!pendingFiles.isEmpty())
+        updateIncremental(snapshot);
+}
+
+QBitArray DependencyTable::directIncludeBits(int index) const
+{
+    QBitArray bitmap(files.size());
+    foreach (int includedFileIndex, includes.value(index))
+        bitmap.setBit(includedFileIndex, true);
+    return bitmap;
+}
+
+void DependencyTable::refreshRow(const Snapshot &snapshot, int index)
+{
+    // Drop the old outgoing edges ...
+    foreach (int includedFileIndex, includes.value(index))
+        includedBy[includedFileIndex].removeOne(index);
+
+    QBitArray bitmap(files.size());
+    QList<int> directIncludes;
+
+    // ... and collect the current ones from the document, if it still exists.
+    if (Document::Ptr doc = snapshot.document(files.at(index))) {
+        foreach (const QString &includedFile, doc->includedFiles()) {
+            const int includedIndex = fileIndex.value(Utils::FileName::fromString(includedFile), -1);
+            if (includedIndex == -1)
+                continue;
+            if (!directIncludes.contains(includedIndex))
+                directIncludes.append(includedIndex);
+            bitmap.setBit(includedIndex, true);
+        }
+    } else {
+        fileIndex.remove(files.at(index));
+        files[index].clear();
+    }
+
+    includes[index] = directIncludes;
+    foreach (int includedFileIndex, directIncludes)
+        includedBy[includedFileIndex].append(index);
+    includeMap[index] = bitmap;
+}
+
+void DependencyTable::updateIncremental(const Snapshot &snapshot)
+{
+    QSet<int> dirtyRows;
+
+    foreach (const Utils::FileName &fileName, pendingFiles) {
+        int index = fileIndex.value(fileName, -1);
+        if (index == -1) {
+            if (!snapshot.contains(fileName))
+                continue;
+            index = files.size();
+            files.append(fileName);
+            fileIndex[fileName] = index;
+            includeMap.append(QBitArray());
+        }
+        dirtyRows.insert(index);
+    }
+    pendingFiles.clear();
+
+    // New documents added new columns; widen all rows accordingly.
+    const int documentCount = files.size();
+    for (int i = 0; i < documentCount; ++i) {
+        if (includeMap.at(i).size() < documentCount)
+            includeMap[i].resize(documentCount);
+    }
+
+    foreach (int index, dirtyRows)
+        refreshRow(snapshot, index);
+
+    // Propagate the changed rows to their includers until a fixed point is
+    // reached; untouched parts of the table are never revisited.
+    QSet<int> queued = dirtyRows;
+    QList<int> worklist = dirtyRows.toList();
+    while (!worklist.isEmpty()) {
+        const int current = worklist.takeFirst();
+        queued.remove(current);
+
+        QBitArray bitmap = directIncludeBits(current);
+        foreach (int includedFileIndex, includes.value(current))
+            bitmap |= includeMap.value(includedFileIndex);
+
+        if (bitmap != includeMap.at(current)) {
+            includeMap[current] = bitmap;
+            foreach (int includerIndex, includedBy.value(current)) {
+                if (!queued.contains(includerIndex)) {
+                    queued.insert(includerIndex);
+                    worklist.append(includerIndex);
+                }
+            }
+        }
+    }
+}
+
 void DependencyTable::build(const Snapshot &snapshot)
 {
     files.clear();
     fileIndex.clear();
     includes.clear();
+    includedBy.clear();
     includeMap.clear();
+    pendingFiles.clear();
 
     const int documentCount = snapshot.size();
     files.resize(documentCount);
@@ -85,6 +196,8 @@ void DependencyTable::build(const Snapshot &snapshot)
 
             includeMap[i] = bitmap;
             includes[i] = directIncludes;
+            foreach (int includedFileIndex, directIncludes)
+                includedBy[includedFileIndex].append(i);
         }
     }
 
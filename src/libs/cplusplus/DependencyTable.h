@@ -31,6 +31,7 @@
 
 #include <QBitArray>
 #include <QHash>
+#include <QSet>
 #include <QString>
 #include <QStringList>
 #include <QVector>
@@ -44,12 +45,20 @@ class CPLUSPLUS_EXPORT DependencyTable
 private:
     friend class Snapshot;
     void build(const Snapshot &snapshot);
+    void scheduleUpdate(const Utils::FileName &fileName);
+    void update(const Snapshot &snapshot);
     Utils::FileNameList filesDependingOn(const Utils::FileName &fileName) const;
 
+    void updateIncremental(const Snapshot &snapshot);
+    void refreshRow(const Snapshot &snapshot, int index);
+    QBitArray directIncludeBits(int index) const;
+
     QVector<Utils::FileName> files;
     QHash<Utils::FileName, int> fileIndex;
     QHash<int, QList<int> > includes;
+    QHash<int, QList<int> > includedBy;
     QVector<QBitArray> includeMap;
+    QSet<Utils::FileName> pendingFiles;
 };
 
 } // namespace CPlusPlus
@@ -67,6 +67,15 @@ FindUsages::FindUsages(const LookupContext &context)
     prepareLines(_originalSource);
 }
 
+/*!
+    Sets a predicate that is polled between top-level declarations. Once it
+    returns true the search stops and the usages collected so far are kept.
+    This allows callers running on worker threads to abort a search in the
+    middle of a large file instead of only between files.
+*/
+void FindUsages::setCancelChecker(const std::function<bool()> &cancelChecker)
+{ _cancelChecker = cancelChecker; }
+
 QList<Usage> FindUsages::usages() const
 { return _usages; }
 
@@ -667,6 +676,8 @@ void FindUsages::translationUnit(TranslationUnitAST *ast)
 
     Scope *previousScope = switchScope(_doc->globalNamespace());
     for (DeclarationListAST *it = ast->declaration_list; it; it = it->next) {
+        if (_cancelChecker && _cancelChecker())
+            break;
         this->declaration(it->value);
     }
     (void) switchScope(previousScope);
@@ -34,6 +34,8 @@
 
 #include <QSet>
 
+#include <functional>
+
 namespace CPlusPlus {
 
 class CPLUSPLUS_EXPORT Usage
@@ -59,6 +61,8 @@ public:
 
     void operator()(Symbol *symbol);
 
+    void setCancelChecker(const std::function<bool()> &cancelChecker);
+
     QList<Usage> usages() const;
     QList<int> references() const;
 
@@ -299,6 +303,7 @@ private:
     QSet<unsigned> _processed;
     TypeOfExpression typeofExpression;
     Scope *_currentScope = nullptr;
+    std::function<bool()> _cancelChecker;
 };
 
 } // namespace CPlusPlus
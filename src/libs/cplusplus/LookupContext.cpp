@@ -432,6 +432,23 @@ QList<LookupItem> LookupContext::lookup(const Name *name, Scope *scope) const
 {
     QList<LookupItem> candidates;
 
+    if (! name)
+        return candidates;
+
+    // Semantic passes such as CheckSymbols resolve the same (scope, name)
+    // pairs over and over; memoize the results in the shared bindings.
+    if (_bindings->findCachedLookup(name, scope, &candidates))
+        return candidates;
+
+    candidates = lookupUncached(name, scope);
+    _bindings->cacheLookup(name, scope, candidates);
+    return candidates;
+}
+
+QList<LookupItem> LookupContext::lookupUncached(const Name *name, Scope *scope) const
+{
+    QList<LookupItem> candidates;
+
     if (! name)
         return candidates;
 
@@ -1603,6 +1620,22 @@ void CreateBindings::process(Symbol *symbol)
     _currentClassOrNamespace->addTodo(symbol);
 }
 
+bool CreateBindings::findCachedLookup(const Name *name, Scope *scope,
+                                      QList<LookupItem> *result) const
+{
+    const QHash<QPair<const Name *, Scope *>, QList<LookupItem> >::ConstIterator it
+            = _lookupCache.constFind(qMakePair(name, scope));
+    if (it == _lookupCache.constEnd())
+        return false;
+    *result = it.value();
+    return true;
+}
+
+void CreateBindings::cacheLookup(const Name *name, Scope *scope, const QList<LookupItem> &result)
+{
+    _lookupCache.insert(qMakePair(name, scope), result);
+}
+
 ClassOrNamespace *CreateBindings::allocClassOrNamespace(ClassOrNamespace *parent)
 {
     ClassOrNamespace *e = new ClassOrNamespace(this, parent);
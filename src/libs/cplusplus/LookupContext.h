@@ -35,6 +35,8 @@
 #include <cplusplus/Control.h>
 #include <cplusplus/Name.h>
 
+#include <QHash>
+#include <QPair>
 #include <QSet>
 #include <QMap>
 
@@ -224,6 +226,19 @@ public:
     /// \internal
     ClassOrNamespace *allocClassOrNamespace(ClassOrNamespace *parent);
 
+    /// Creates bindings for the given \a document and its includes, unless
+    /// they have been processed before.
+    /// \internal
+    void process(Document::Ptr document);
+
+    /// Memoized results of LookupContext::lookup(). The bindings are shared
+    /// between the lookup contexts of one semantic pass and are recreated
+    /// when the snapshot changes, so the cached results cannot go stale.
+    /// \internal
+    bool findCachedLookup(const Name *name, Scope *scope, QList<LookupItem> *result) const;
+    /// \internal
+    void cacheLookup(const Name *name, Scope *scope, const QList<LookupItem> &result);
+
 protected:
     using SymbolVisitor::visit;
 
@@ -237,9 +252,6 @@ protected:
     /// namespace binding.
     ClassOrNamespace *enterGlobalClassOrNamespace(Symbol *symbol);
 
-    /// Creates bindings for the given \a document.
-    void process(Document::Ptr document);
-
     /// Creates bindings for the symbols reachable from the \a root symbol.
     void process(Symbol *root);
 
@@ -276,6 +288,7 @@ private:
     ClassOrNamespace *_globalNamespace;
     ClassOrNamespace *_currentClassOrNamespace;
     bool _expandTemplates;
+    QHash<QPair<const Name *, Scope *>, QList<LookupItem> > _lookupCache;
 };
 
 class CPLUSPLUS_EXPORT LookupContext
@@ -327,6 +340,7 @@ public:
     }
 
 private:
+    QList<LookupItem> lookupUncached(const Name *name, Scope *scope) const;
     QList<LookupItem> lookupByUsing(const Name *name, ClassOrNamespace *bindingScope) const;
 
     // The current expression.
@@ -102,7 +102,10 @@ Macro *Environment::bind(const Macro &macro)
 
     Macro *m = new Macro (macro);
     const QByteArray &name = m->name();
-    m->_hashcode = hashCode(name.begin(), name.size());
+    // Copies of macros that were bound before, e.g. the exported macros of an
+    // included document, already carry their name hash.
+    if (! m->_hashcode)
+        m->_hashcode = hashCode(name.begin(), name.size());
 
     if (++_macro_count == _allocated_macros) {
         if (! _allocated_macros)
@@ -128,6 +131,9 @@ Macro *Environment::bind(const Macro &macro)
 
 void Environment::addMacros(const QList<Macro> &macros)
 {
+    // Merging the state of an included document binds its macros in one go,
+    // so grow the table upfront instead of rehashing it several times.
+    reserve(macroCount() + macros.size());
     foreach (const Macro &macro, macros) {
         bind(macro);
     }
@@ -243,6 +249,23 @@ Macro *Environment::resolve(const ByteArrayRef &name) const
     return it;
 }
 
+void Environment::reserve(int macroCount)
+{
+    if (macroCount <= (_hash_count >> 1) && _hash)
+        return;
+
+    while (macroCount > (_hash_count >> 1))
+        _hash_count <<= 1;
+
+    // rehash() doubles the bucket count only when a table exists, so free it
+    // here to make it build the table at the count computed above.
+    if (_hash) {
+        free(_hash);
+        _hash = 0;
+    }
+    rehash();
+}
+
 void Environment::rehash()
 {
     if (_hash) {
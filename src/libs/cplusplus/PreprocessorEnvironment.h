@@ -84,6 +84,7 @@ public:
 
 private:
     void rehash();
+    void reserve(int macroCount);
 
 public:
     QString currentFile;
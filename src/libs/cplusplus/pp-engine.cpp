@@ -167,6 +167,14 @@ struct TokenBuffer
         : tokens(start, end), macro(macro), next(next)
     {}
 
+    void reinit(const PPToken *start, const PPToken *end, const Macro *newMacro,
+                TokenBuffer *newNext)
+    {
+        tokens.assign(start, end);
+        macro = newMacro;
+        next = newNext;
+    }
+
     bool isBlocked(const Macro *macro) const {
         if (!macro)
             return false;
@@ -599,6 +607,7 @@ Preprocessor::State::State()
     , m_ifLevel(0)
     , m_tokenBufferDepth(0)
     , m_tokenBuffer(0)
+    , m_tokenBufferPool(0)
     , m_inPreprocessorDirective(false)
     , m_markExpandedTokens(true)
     , m_noLines(false)
@@ -618,6 +627,19 @@ Preprocessor::State::State()
 }
 
 #define COMPRESS_TOKEN_BUFFER
+static TokenBuffer *allocateTokenBuffer(TokenBuffer **pool, const PPToken *start,
+                                        const PPToken *end, const Macro *macro,
+                                        TokenBuffer *next)
+{
+    if (pool && *pool) {
+        TokenBuffer *buffer = *pool;
+        *pool = buffer->next;
+        buffer->reinit(start, end, macro, next);
+        return buffer;
+    }
+    return new TokenBuffer(start, end, macro, next);
+}
+
 void Preprocessor::State::pushTokenBuffer(const PPToken *start, const PPToken *end, const Macro *macro)
 {
     if (m_tokenBufferDepth <= MAX_TOKEN_BUFFER_DEPTH) {
@@ -625,7 +647,8 @@ void Preprocessor::State::pushTokenBuffer(const PPToken *start, const PPToken *e
         if (macro || !m_tokenBuffer) {
             // If there is a new blocking macro (or no token buffer yet), create
             // one.
-            m_tokenBuffer = new TokenBuffer(start, end, macro, m_tokenBuffer);
+            m_tokenBuffer = allocateTokenBuffer(m_tokenBufferPool, start, end, macro,
+                                                m_tokenBuffer);
             ++m_tokenBufferDepth;
         } else {
             // No new blocking macro is passed in, so tokens can be prepended to
@@ -633,7 +656,7 @@ void Preprocessor::State::pushTokenBuffer(const PPToken *start, const PPToken *e
             m_tokenBuffer->tokens.insert(m_tokenBuffer->tokens.begin(), start, end);
         }
 #else
-        m_tokenBuffer = new TokenBuffer(start, end, macro, m_tokenBuffer);
+        m_tokenBuffer = allocateTokenBuffer(m_tokenBufferPool, start, end, macro, m_tokenBuffer);
         ++m_tokenBufferDepth;
 #endif
     }
@@ -643,7 +666,16 @@ void Preprocessor::State::popTokenBuffer()
 {
     TokenBuffer *r = m_tokenBuffer;
     m_tokenBuffer = m_tokenBuffer->next;
-    delete r;
+
+    // Keep the node (and its token storage) around for reuse instead of
+    // deleting it; macro-heavy files pop buffers millions of times.
+    if (m_tokenBufferPool) {
+        r->tokens.clear();
+        r->next = *m_tokenBufferPool;
+        *m_tokenBufferPool = r;
+    } else {
+        delete r;
+    }
 
     if (m_tokenBufferDepth)
         --m_tokenBufferDepth;
@@ -736,11 +768,21 @@ QString Preprocessor::configurationFileName() { return QStringLiteral("<configur
 Preprocessor::Preprocessor(Client *client, Environment *env)
     : m_client(client)
     , m_env(env)
+    , m_tokenBufferPool(0)
     , m_expandFunctionlikeMacros(true)
     , m_keepComments(false)
 {
 }
 
+Preprocessor::~Preprocessor()
+{
+    while (m_tokenBufferPool) {
+        TokenBuffer *buffer = m_tokenBufferPool;
+        m_tokenBufferPool = buffer->next;
+        delete buffer;
+    }
+}
+
 QByteArray Preprocessor::run(const QString &fileName, const QString &source)
 {
     return run(fileName, source.toUtf8());
@@ -1390,6 +1432,7 @@ void Preprocessor::preprocess(const QString &fileName, const QByteArray &source,
         return;
 
     ScopedSwap<State> savedState(m_state, State());
+    m_state.m_tokenBufferPool = &m_tokenBufferPool;
     m_state.m_currentFileName = fileName;
     m_state.m_source = source;
     m_state.m_lexer = new Lexer(source.constBegin(), source.constEnd());
@@ -78,6 +78,7 @@ public:
 
 public:
     Preprocessor(Client *client, Environment *env);
+    ~Preprocessor();
 
     QByteArray run(const QString &filename, const QString &source);
     QByteArray run(const QString &filename, const QByteArray &source,
@@ -123,6 +124,10 @@ private:
         int m_ifLevel;
         unsigned m_tokenBufferDepth;
         Internal::TokenBuffer *m_tokenBuffer;
+        // Free list of token buffers, owned by the Preprocessor. It outlives
+        // the per-file states, so macro expansion reuses the nodes (and their
+        // token storage) instead of hitting the allocator per expansion.
+        Internal::TokenBuffer **m_tokenBufferPool;
         bool m_inPreprocessorDirective;
 
         bool m_markExpandedTokens;
@@ -257,6 +262,7 @@ private:
 private:
     Client *m_client;
     Environment *m_env;
+    Internal::TokenBuffer *m_tokenBufferPool;
     QByteArray m_scratchBuffer;
     CancelChecker m_cancelChecker;
 
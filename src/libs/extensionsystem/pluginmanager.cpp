@@ -35,6 +35,9 @@
 #include <QDateTime>
 #include <QDir>
 #include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QLibrary>
 #include <QLibraryInfo>
 #include <QMetaProperty>
@@ -1300,9 +1303,10 @@ void PluginManagerPrivate::asyncShutdownFinished()
 QList<PluginSpec *> PluginManagerPrivate::loadQueue()
 {
     QList<PluginSpec *> queue;
+    QSet<PluginSpec *> queued;
     foreach (PluginSpec *spec, pluginSpecs) {
         QList<PluginSpec *> circularityCheckQueue;
-        loadQueue(spec, queue, circularityCheckQueue);
+        loadQueue(spec, queue, queued, circularityCheckQueue);
     }
     return queue;
 }
@@ -1311,9 +1315,11 @@ QList<PluginSpec *> PluginManagerPrivate::loadQueue()
     \internal
 */
 bool PluginManagerPrivate::loadQueue(PluginSpec *spec, QList<PluginSpec *> &queue,
-        QList<PluginSpec *> &circularityCheckQueue)
+        QSet<PluginSpec *> &queued, QList<PluginSpec *> &circularityCheckQueue)
 {
-    if (queue.contains(spec))
+    // the set mirrors the queue; checking it keeps building the queue linear
+    // in the number of plugins instead of quadratic
+    if (queued.contains(spec))
         return true;
     // check for circular dependencies
     if (circularityCheckQueue.contains(spec)) {
@@ -1333,6 +1339,7 @@ bool PluginManagerPrivate::loadQueue(PluginSpec *spec, QList<PluginSpec *> &queu
     // check if we have the dependencies
     if (spec->state() == PluginSpec::Invalid || spec->state() == PluginSpec::Read) {
         queue.append(spec);
+        queued.insert(spec);
         return false;
     }
 
@@ -1345,7 +1352,7 @@ bool PluginManagerPrivate::loadQueue(PluginSpec *spec, QList<PluginSpec *> &queu
         if (it.key().type == PluginDependency::Test)
             continue;
         PluginSpec *depSpec = it.value();
-        if (!loadQueue(depSpec, queue, circularityCheckQueue)) {
+        if (!loadQueue(depSpec, queue, queued, circularityCheckQueue)) {
             spec->d->hasError = true;
             spec->d->errorString =
                 PluginManager::tr("Cannot load plugin because dependency failed to load: %1(%2)\nReason: %3")
@@ -1355,6 +1362,7 @@ bool PluginManagerPrivate::loadQueue(PluginSpec *spec, QList<PluginSpec *> &queu
     }
     // add self
     queue.append(spec);
+    queued.insert(spec);
     return true;
 }
 
@@ -1511,9 +1519,10 @@ void PluginManagerPrivate::enableOnlyTestedSpecs()
         return;
 
     QList<PluginSpec *> specsForTests;
+    QSet<PluginSpec *> queued;
     foreach (const TestSpec &testSpec, testSpecs) {
         QList<PluginSpec *> circularityCheckQueue;
-        loadQueue(testSpec.pluginSpec, specsForTests, circularityCheckQueue);
+        loadQueue(testSpec.pluginSpec, specsForTests, queued, circularityCheckQueue);
         // add plugins that must be force loaded when running tests for the plugin
         // (aka "test dependencies")
         QHashIterator<PluginDependency, PluginSpec *> it(testSpec.pluginSpec->dependencySpecs());
@@ -1523,7 +1532,7 @@ void PluginManagerPrivate::enableOnlyTestedSpecs()
                 continue;
             PluginSpec *depSpec = it.value();
             circularityCheckQueue.clear();
-            loadQueue(depSpec, specsForTests, circularityCheckQueue);
+            loadQueue(depSpec, specsForTests, queued, circularityCheckQueue);
         }
     }
     foreach (PluginSpec *spec, pluginSpecs)
@@ -1581,6 +1590,20 @@ void PluginManagerPrivate::profilingReport(const char *what, const PluginSpec *s
             qDebug("%-22s %-22s %8dms (%8dms)", what, qPrintable(spec->name()), absoluteElapsedMS, elapsedMS);
         else
             qDebug("%-45s %8dms (%8dms)", what, absoluteElapsedMS, elapsedMS);
+        // record spans for the optional startup trace
+        if (what[0] == '>') {
+            ProfileSpan span;
+            span.what = what + 1;
+            if (spec)
+                span.plugin = spec->name();
+            span.startMS = absoluteElapsedMS;
+            span.durationMS = -1;
+            m_profileSpanStack.append(m_profileSpans.size());
+            m_profileSpans.append(span);
+        } else if (what[0] == '<' && !m_profileSpanStack.isEmpty()) {
+            ProfileSpan &span = m_profileSpans[m_profileSpanStack.takeLast()];
+            span.durationMS = absoluteElapsedMS - span.startMS;
+        }
     }
 }
 
@@ -1601,7 +1624,44 @@ void PluginManagerPrivate::profilingSummary() const
             qDebug("%-22s %8dms   ( %5.2f%% )", qPrintable(it.value()->name()),
                 it.key(), 100.0 * it.key() / total);
          qDebug("Total: %8dms", total);
+
+        const QString traceFileName = QFile::decodeName(qgetenv("QTC_STARTUP_TRACE"));
+        if (!traceFileName.isEmpty())
+            writeProfilingTrace(traceFileName);
+    }
+}
+
+/*
+    Writes the spans recorded while profiling to \a fileName in the JSON trace
+    event format, which the trace viewer built into Chromium-based browsers
+    (about:tracing) and similar tools can load. Set QTC_STARTUP_TRACE to a file
+    name and pass -profile to get a trace of a complete startup.
+*/
+void PluginManagerPrivate::writeProfilingTrace(const QString &fileName) const
+{
+    QJsonArray events;
+    foreach (const ProfileSpan &span, m_profileSpans) {
+        if (span.durationMS < 0)
+            continue; // span was never closed
+        QString name = QLatin1String(span.what.constData());
+        if (!span.plugin.isEmpty())
+            name += QLatin1Char(' ') + span.plugin;
+        QJsonObject event;
+        event.insert(QLatin1String("name"), name);
+        event.insert(QLatin1String("ph"), QLatin1String("X"));
+        event.insert(QLatin1String("ts"), span.startMS * 1000);
+        event.insert(QLatin1String("dur"), span.durationMS * 1000);
+        event.insert(QLatin1String("pid"), 1);
+        event.insert(QLatin1String("tid"), 1);
+        events.append(event);
+    }
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning("Cannot write startup trace to \"%s\"", qPrintable(fileName));
+        return;
     }
+    file.write(QJsonDocument(events).toJson());
+    qDebug("Startup trace written to \"%s\"", qPrintable(fileName));
 }
 
 static inline QString getPlatformName()
@@ -34,6 +34,7 @@
 #include <QObject>
 #include <QScopedPointer>
 #include <QReadWriteLock>
+#include <QVector>
 
 QT_BEGIN_NAMESPACE
 class QTime;
@@ -72,6 +73,7 @@ public:
     void initProfiling();
     void profilingSummary() const;
     void profilingReport(const char *what, const PluginSpec *spec = 0);
+    void writeProfilingTrace(const QString &fileName) const;
     void setSettings(QSettings *settings);
     void setGlobalSettings(QSettings *settings);
     void readSettings();
@@ -117,6 +119,16 @@ public:
     QHash<const PluginSpec *, int> m_profileTotal;
     int m_profileElapsedMS;
     unsigned m_profilingVerbosity;
+    // one span per ">x"/"<x" pair reported while profiling is active
+    class ProfileSpan {
+    public:
+        QByteArray what;
+        QString plugin;
+        int startMS;
+        int durationMS;
+    };
+    QVector<ProfileSpan> m_profileSpans;
+    QList<int> m_profileSpanStack; // indexes of spans not yet closed
     QSettings *settings;
     QSettings *globalSettings;
 
@@ -141,6 +153,7 @@ private:
     void readPluginPaths();
     bool loadQueue(PluginSpec *spec,
             QList<PluginSpec *> &queue,
+            QSet<PluginSpec *> &queued,
             QList<PluginSpec *> &circularityCheckQueue);
     void stopAll();
     void deleteAll();
@@ -226,7 +226,8 @@ DElement *DiagramSceneModel::findTopmostElement(const QPointF &scenePos) const
     // fetch affected items from scene in correct drawing order to find topmost element
     QList<QGraphicsItem *> items = m_graphicsScene->items(scenePos);
     foreach (QGraphicsItem *item, items) {
-        if (m_graphicsItems.contains(item))
+        // the item map only contains the items backed by a DElement
+        if (m_itemToElementMap.contains(item))
             return m_itemToElementMap.value(item);
     }
     return 0;
@@ -245,7 +246,7 @@ ObjectItem *DiagramSceneModel::findTopmostObjectItem(const QPointF &scenePos) co
     // fetch affected items from scene in correct drawing order to find topmost element
     const QList<QGraphicsItem *> items = m_graphicsScene->items(scenePos);
     for (QGraphicsItem *item : Utils::asConst(items)) {
-        if (m_graphicsItems.contains(item)) {
+        if (m_itemToElementMap.contains(item)) {
             DObject *object = dynamic_cast<DObject *>(m_itemToElementMap.value(item));
             if (object)
                 return dynamic_cast<ObjectItem *>(item);
@@ -544,43 +545,39 @@ QList<QGraphicsItem *> DiagramSceneModel::collectCollidingObjectItems(const QGra
     QRectF rect = resizable->rect();
     rect.translate(resizable->pos());
 
-    switch (collidingMode) {
-    case CollidingInnerItems:
-        foreach (QGraphicsItem *candidate, m_graphicsItems) {
-            if (auto candidateResizable = dynamic_cast<const IResizable *>(candidate)) {
-                QRectF candidateRect = candidateResizable->rect();
-                candidateRect.translate(candidateResizable->pos());
-                if (candidateRect.left() >= rect.left() && candidateRect.right() <= rect.right()
-                        && candidateRect.top() >= rect.top() && candidateRect.bottom() <= rect.bottom()) {
-                    collidingItems.append(candidate);
-                }
+    // Ask the scene for the candidates; its spatial index narrows them down to
+    // the items whose bounding rect touches the given rect, which is a
+    // necessary condition for all three colliding modes.
+    const QList<QGraphicsItem *> candidates
+            = m_graphicsScene->items(rect, Qt::IntersectsItemBoundingRect);
+    for (QGraphicsItem *candidate : candidates) {
+        if (!m_itemToElementMap.contains(candidate))
+            continue;
+        auto candidateResizable = dynamic_cast<const IResizable *>(candidate);
+        if (!candidateResizable)
+            continue;
+        QRectF candidateRect = candidateResizable->rect();
+        candidateRect.translate(candidateResizable->pos());
+        switch (collidingMode) {
+        case CollidingInnerItems:
+            if (candidateRect.left() >= rect.left() && candidateRect.right() <= rect.right()
+                    && candidateRect.top() >= rect.top() && candidateRect.bottom() <= rect.bottom()) {
+                collidingItems.append(candidate);
             }
-        }
-        break;
-    case CollidingItems:
-        foreach (QGraphicsItem *candidate, m_graphicsItems) {
-            if (auto candidateResizable = dynamic_cast<const IResizable *>(candidate)) {
-                QRectF candidateRect = candidateResizable->rect();
-                candidateRect.translate(candidateResizable->pos());
-                if (candidateRect.left() <= rect.right() && candidateRect.right() >= rect.left()
-                        && candidateRect.top() <= rect.bottom() && candidateRect.bottom() >= rect.top()) {
-                    collidingItems.append(candidate);
-                }
+            break;
+        case CollidingItems:
+            if (candidateRect.left() <= rect.right() && candidateRect.right() >= rect.left()
+                    && candidateRect.top() <= rect.bottom() && candidateRect.bottom() >= rect.top()) {
+                collidingItems.append(candidate);
             }
-        }
-        break;
-    case CollidingOuterItems:
-        foreach (QGraphicsItem *candidate, m_graphicsItems) {
-            if (auto candidateResizable = dynamic_cast<const IResizable *>(candidate)) {
-                QRectF candidateRect = candidateResizable->rect();
-                candidateRect.translate(candidateResizable->pos());
-                if (candidateRect.left() <= rect.left() && candidateRect.right() >= rect.right()
-                        && candidateRect.top() <= rect.top() && candidateRect.bottom() >= rect.bottom()) {
-                    collidingItems.append(candidate);
-                }
+            break;
+        case CollidingOuterItems:
+            if (candidateRect.left() <= rect.left() && candidateRect.right() >= rect.right()
+                    && candidateRect.top() <= rect.top() && candidateRect.bottom() >= rect.bottom()) {
+                collidingItems.append(candidate);
             }
+            break;
         }
-        break;
     }
     return collidingItems;
 }
@@ -835,10 +832,14 @@ void DiagramSceneModel::onSelectionChanged()
     }
 
 
-    // select all relations where both ends are primary or secondary selected
-    foreach (DElement *element, m_diagram->diagramElements()) {
-        auto relation = dynamic_cast<DRelation *>(element);
-        if (relation) {
+    // select all relations where both ends are primary or secondary selected;
+    // without any selected object no relation can qualify, so skip the scan
+    // over all diagram elements (e.g. when the selection is cleared)
+    if (!m_selectedItems.isEmpty() || !newSecondarySelectedItems.isEmpty()) {
+        foreach (DElement *element, m_diagram->diagramElements()) {
+            auto relation = dynamic_cast<DRelation *>(element);
+            if (!relation)
+                continue;
             QGraphicsItem *relationItem = m_elementToItemMap.value(relation);
             QMT_ASSERT(relationItem, return);
             DObject *endAObject = m_diagramController->findElement<DObject>(relation->endAUid(), m_diagram);
@@ -616,6 +616,7 @@ void ImportDependencies::filter(const ViewerContext &vContext)
         return;
     m_coreImports = newCoreImports;
     m_importCache = newImportCache;
+    m_libraryImportsCacheValid = false;
 }
 
 CoreImport ImportDependencies::coreImport(const QString &importId) const
@@ -639,7 +640,7 @@ void ImportDependencies::iterateOnCandidateImports(
         foreach (const QString &cImportName, imp) {
             CoreImport cImport = coreImport(cImportName);
             if (vContext.languageIsCompatible(cImport.language)) {
-                foreach (const Export e, cImport.possibleExports) {
+                foreach (const Export &e, cImport.possibleExports) {
                     if (e.visibleInVContext(vContext)) {
                         ImportMatchStrength m = e.exportName.matchImport(key, vContext);
                         if (m.hasMatch()) {
@@ -661,7 +662,7 @@ void ImportDependencies::iterateOnCandidateImports(
             foreach (const QString &cImportName, lb.value()) {
                 CoreImport cImport = coreImport(cImportName);
                 if (vContext.languageIsCompatible(cImport.language)) {
-                    foreach (const Export e, cImport.possibleExports) {
+                    foreach (const Export &e, cImport.possibleExports) {
                         if (e.visibleInVContext(vContext)) {
                             ImportMatchStrength m = e.exportName.matchImport(key, vContext);
                             if (m.hasMatch()) {
@@ -738,6 +739,7 @@ void ImportDependencies::addCoreImport(const CoreImport &import)
     foreach (const Export &e, import.possibleExports)
         m_importCache[e.exportName].append(import.importId);
     m_coreImports.insert(newImport.importId, newImport);
+    m_libraryImportsCacheValid = false;
     if (importsLog().isDebugEnabled()) {
         QString msg = QString::fromLatin1("added import %1 for").arg(newImport.importId);
         foreach (const Export &e, newImport.possibleExports)
@@ -763,6 +765,7 @@ void ImportDependencies::removeCoreImport(const QString &importId)
         cImport.possibleExports = newExports;
     else
         m_coreImports.remove(importId);
+    m_libraryImportsCacheValid = false;
 
     qCDebug(importsLog) << "removed import with id:"<< importId;
 }
@@ -781,6 +784,7 @@ void ImportDependencies::removeImportCacheEntry(const ImportKey &importKey, cons
 void ImportDependencies::addExport(const QString &importId, const ImportKey &importKey,
                                    const QString &requiredPath, const QString &typeName)
 {
+    m_libraryImportsCacheValid = false;
     if (!m_coreImports.contains(importId)) {
         CoreImport newImport(importId);
         newImport.language = Dialect::AnyLanguage;
@@ -799,6 +803,7 @@ void ImportDependencies::addExport(const QString &importId, const ImportKey &imp
 void ImportDependencies::removeExport(const QString &importId, const ImportKey &importKey,
                                       const QString &requiredPath, const QString &typeName)
 {
+    m_libraryImportsCacheValid = false;
     if (!m_coreImports.contains(importId)) {
         qCWarning(importsLog) << "non existing core import for removeExport(" << importId << ", "
                               << importKey.toString() << ")";
@@ -915,11 +920,28 @@ public:
     }
 };
 
+static bool sameVContext(const ViewerContext &vContext1, const ViewerContext &vContext2)
+{
+    return vContext1.language == vContext2.language
+            && vContext1.flags == vContext2.flags
+            && vContext1.selectors == vContext2.selectors
+            && vContext1.paths == vContext2.paths;
+}
+
 QSet<ImportKey> ImportDependencies::libraryImports(const ViewerContext &viewContext) const
 {
+    // this is requested with the same context again and again (for example on
+    // every update of the possible imports of a designer document), while the
+    // imports change only when a library is added or removed, so the last
+    // result is memoized
+    if (m_libraryImportsCacheValid && sameVContext(viewContext, m_libraryImportsContext))
+        return m_libraryImportsCache;
     QSet<ImportKey> res;
     CollectImportKeys importCollector(res);
     iterateOnLibraryImports(viewContext, importCollector);
+    m_libraryImportsCache = res;
+    m_libraryImportsContext = viewContext;
+    m_libraryImportsCacheValid = true;
     return res;
 }
 
@@ -27,6 +27,7 @@
 
 #include "qmljsconstants.h"
 #include "qmljsdialect.h"
+#include "qmljsviewercontext.h"
 
 #include <languageutils/componentversion.h>
 
@@ -228,6 +229,10 @@ private:
 
     QMap<ImportKey, QStringList> m_importCache;
     QMap<QString, CoreImport> m_coreImports;
+    // memoized libraryImports() result, invalidated whenever imports change
+    mutable QSet<ImportKey> m_libraryImportsCache;
+    mutable ViewerContext m_libraryImportsContext;
+    mutable bool m_libraryImportsCacheValid = false;
 };
 
 } // namespace QmlJS
@@ -1410,7 +1410,6 @@ const QLatin1String CppQmlTypes::cppPackage("<cpp>");
 template <typename T>
 void CppQmlTypes::load(const QString &originId, const T &fakeMetaObjects, const QString &overridePackage)
 {
-    QList<CppComponentValue *> newCppTypes;
     foreach (const FakeMetaObject::ConstPtr &fmo, fakeMetaObjects) {
         foreach (const FakeMetaObject::Export &exp, fmo->exports()) {
             QString package = exp.package;
@@ -1418,27 +1417,16 @@ void CppQmlTypes::load(const QString &originId, const T &fakeMetaObjects, const
                 package = overridePackage;
             m_fakeMetaObjectsByPackage[package].insert(FakeMetaObjectWithOrigin(fmo, originId));
 
-            // make versionless cpp types directly
+            // remember versionless cpp types, the wrappers are made on demand in objectByCppName
             // needed for access to property types that are not exported, like QDeclarativeAnchors
             if (exp.package == cppPackage) {
                 QTC_ASSERT(exp.version == ComponentVersion(), continue);
                 QTC_ASSERT(exp.type == fmo->className(), continue);
-                CppComponentValue *cppValue = new CppComponentValue(
-                            fmo, fmo->className(), cppPackage, ComponentVersion(), ComponentVersion(),
-                            ComponentVersion::MaxVersion, m_valueOwner, originId);
-                m_objectsByQualifiedName[qualifiedName(cppPackage, fmo->className(), ComponentVersion())] = cppValue;
-                newCppTypes += cppValue;
+                m_cppFakeMetaObjects.insert(fmo->className(),
+                                            FakeMetaObjectWithOrigin(fmo, originId));
             }
         }
     }
-
-    // set prototypes of cpp types
-    foreach (CppComponentValue *object, newCppTypes) {
-        const QString &protoCppName = object->metaObject()->superclassName();
-        const CppComponentValue *proto = objectByCppName(protoCppName);
-        if (proto)
-            object->setPrototype(proto);
-    }
 }
 
 // explicitly instantiate load for list and hash
@@ -1569,7 +1557,33 @@ const CppComponentValue *CppQmlTypes::objectByQualifiedName(const QString &packa
 
 const CppComponentValue *CppQmlTypes::objectByCppName(const QString &cppName) const
 {
-    return objectByQualifiedName(qualifiedName(cppPackage, cppName, ComponentVersion()));
+    const QString key = qualifiedName(cppPackage, cppName, ComponentVersion());
+    if (const CppComponentValue *object = m_objectsByQualifiedName.value(key))
+        return object;
+
+    // Make the wrapper on first use. Every value owner loads thousands of
+    // fake metaobjects, but a document typically looks up only a handful of
+    // versionless cpp types, so making them all eagerly wastes a lot of
+    // memory per context.
+    const auto found = m_cppFakeMetaObjects.constFind(cppName);
+    if (found == m_cppFakeMetaObjects.constEnd())
+        return 0;
+
+    CppComponentValue *object = new CppComponentValue(
+                found->fakeMetaObject, cppName, cppPackage, ComponentVersion(),
+                ComponentVersion(), ComponentVersion::MaxVersion, m_valueOwner,
+                found->originId);
+    m_objectsByQualifiedName.insert(key, object);
+
+    // Resolving the prototype recursively makes the whole superclass chain;
+    // the map entry above terminates cyclic hierarchies.
+    const QString &protoCppName = found->fakeMetaObject->superclassName();
+    if (!protoCppName.isEmpty()) {
+        if (const CppComponentValue *proto = objectByCppName(protoCppName))
+            object->setPrototype(proto);
+    }
+
+    return object;
 }
 
 void CppQmlTypes::setCppContextProperties(const ObjectValue *contextProperties)
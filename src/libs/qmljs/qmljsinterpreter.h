@@ -769,7 +769,9 @@ public:
 
 private:
     // "Package.CppName ImportVersion" ->  CppComponentValue
-    QHash<QString, const CppComponentValue *> m_objectsByQualifiedName;
+    // mutable: objectByCppName creates versionless cpp wrappers on demand
+    mutable QHash<QString, const CppComponentValue *> m_objectsByQualifiedName;
+    QHash<QString, FakeMetaObjectWithOrigin> m_cppFakeMetaObjects;
     QHash<QString, QSet<FakeMetaObjectWithOrigin> > m_fakeMetaObjectsByPackage;
     const ObjectValue *m_cppContextProperties;
     ValueOwner *m_valueOwner;
@@ -45,10 +45,13 @@
 #include <QRegExp>
 #include <QTextDocument>
 #include <QTextStream>
+#include <QThread>
 #include <QTimer>
 #include <QtAlgorithms>
+#include <QtConcurrentMap>
 #include <QLibraryInfo>
 
+#include <functional>
 #include <stdio.h>
 
 namespace QmlJS {
@@ -869,34 +872,25 @@ static void findNewLibraryImports(const Document::Ptr &doc, const Snapshot &snap
     }
 }
 
-void ModelManagerInterface::parseLoop(QSet<QString> &scannedPaths,
-                             QSet<QString> &newLibraries,
-                             WorkingCopy workingCopy,
-                             QStringList files,
-                             ModelManagerInterface *modelManager,
-                             Dialect mainLanguage,
-                             bool emitDocChangedOnDisk,
-                             std::function<bool(qreal)> reportProgress)
+class ParseFile: public std::unary_function<QString, Document::MutablePtr>
 {
-    for (int i = 0; i < files.size(); ++i) {
-        if (!reportProgress(qreal(i) / files.size()))
-            return;
-
-        const QString fileName = files.at(i);
+public:
+    ParseFile(const ModelManagerInterface::WorkingCopy &workingCopy, Dialect mainLanguage)
+        : workingCopy(workingCopy), mainLanguage(mainLanguage)
+    { }
 
-        Dialect language = guessLanguageOfFile(fileName);
-        if (language == Dialect::NoLanguage) {
-            if (fileName.endsWith(QLatin1String(".qrc")))
-                modelManager->updateQrcFile(fileName);
-            continue;
-        }
+    Document::MutablePtr operator()(const QString &fileName) const
+    {
+        Dialect language = ModelManagerInterface::guessLanguageOfFile(fileName);
+        if (language == Dialect::NoLanguage)
+            return Document::MutablePtr();
         if (language == Dialect::Qml
                 && (mainLanguage == Dialect::QmlQtQuick1 || mainLanguage == Dialect::QmlQtQuick2))
             language = mainLanguage;
         if (language == Dialect::Qml && mainLanguage == Dialect::QmlQtQuick2Ui)
             language = Dialect::QmlQtQuick2;
         if (language == Dialect::QmlTypeInfo || language == Dialect::QmlProject)
-            continue;
+            return Document::MutablePtr();
         QString contents;
         int documentRevision = 0;
 
@@ -919,6 +913,51 @@ void ModelManagerInterface::parseLoop(QSet<QString> &scannedPaths,
         doc->setSource(contents);
         doc->parse();
 
+        return doc;
+    }
+
+private:
+    ModelManagerInterface::WorkingCopy workingCopy;
+    Dialect mainLanguage;
+};
+
+void ModelManagerInterface::parseLoop(QSet<QString> &scannedPaths,
+                             QSet<QString> &newLibraries,
+                             WorkingCopy workingCopy,
+                             QStringList files,
+                             ModelManagerInterface *modelManager,
+                             Dialect mainLanguage,
+                             bool emitDocChangedOnDisk,
+                             std::function<bool(qreal)> reportProgress)
+{
+    // Parsing a file depends on no other file, so it is done chunk-wise on
+    // all cores. Import discovery stays sequential because it feeds newly
+    // found files back into the list and updates the shared scanned-path and
+    // library sets. Documents still enter the snapshot one by one, so
+    // consumers get context for the open editor before the loop finishes.
+    const ParseFile parseFile(workingCopy, mainLanguage);
+    const int chunkSize = qMax(8, 4 * QThread::idealThreadCount());
+    QList<Document::MutablePtr> parsedChunk;
+    int chunkStart = 0;
+
+    for (int i = 0; i < files.size(); ++i) {
+        if (!reportProgress(qreal(i) / files.size()))
+            return;
+
+        if (i - chunkStart >= parsedChunk.size()) {
+            chunkStart = i;
+            parsedChunk = QtConcurrent::blockingMapped(files.mid(i, chunkSize), parseFile);
+        }
+
+        const QString fileName = files.at(i);
+
+        Document::MutablePtr doc = parsedChunk.at(i - chunkStart);
+        if (doc.isNull()) {
+            if (fileName.endsWith(QLatin1String(".qrc")))
+                modelManager->updateQrcFile(fileName);
+            continue;
+        }
+
         // update snapshot. requires synchronization, but significantly reduces amount of file
         // system queries for library imports because queries are cached in libraryInfo
         const Snapshot snapshot = modelManager->snapshot();
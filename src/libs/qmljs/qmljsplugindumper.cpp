@@ -34,8 +34,11 @@
 #include <utils/fileutils.h>
 #include <utils/hostosinfo.h>
 
+#include <QCryptographicHash>
+#include <QDateTime>
 #include <QDir>
 #include <QRegularExpression>
+#include <QStandardPaths>
 
 using namespace LanguageUtils;
 using namespace QmlJS;
@@ -294,6 +297,7 @@ void PluginDumper::qmlPluginTypeDumpDone(int exitCode)
     process->deleteLater();
 
     const QString libraryPath = m_runningQmldumps.take(process);
+    const QString cacheFilePath = m_dumpCacheFiles.take(process);
     if (libraryPath.isEmpty())
         return;
     const Snapshot snapshot = m_modelManager->snapshot();
@@ -326,6 +330,14 @@ void PluginDumper::qmlPluginTypeDumpDone(int exitCode)
             libraryInfo.setMetaObjects(objectsList.values());
             libraryInfo.setModuleApis(moduleApis);
             libraryInfo.setPluginTypeInfoStatus(LibraryInfo::DumpDone);
+
+            // Remember the dump for the next session. A failed write only
+            // costs a redump.
+            if (!cacheFilePath.isEmpty()) {
+                Utils::FileSaver saver(cacheFilePath);
+                saver.write(output);
+                saver.finalize();
+            }
         }
 
         if (!warning.isEmpty())
@@ -344,6 +356,7 @@ void PluginDumper::qmlPluginTypeDumpError(QProcess::ProcessError)
     process->deleteLater();
 
     const QString libraryPath = m_runningQmldumps.take(process);
+    m_dumpCacheFiles.remove(process);
     if (libraryPath.isEmpty())
         return;
     const QString errorMessages = qmlPluginDumpErrorMessage(process);
@@ -514,7 +527,7 @@ void PluginDumper::loadQmltypesFile(const QStringList &qmltypesFilePaths,
 }
 
 void PluginDumper::runQmlDump(const QmlJS::ModelManagerInterface::ProjectInfo &info,
-    const QStringList &arguments, const QString &importPath)
+    const QStringList &arguments, const QString &importPath, const QString &cacheFilePath)
 {
     QDir wd = QDir(importPath);
     wd.cdUp();
@@ -527,6 +540,93 @@ void PluginDumper::runQmlDump(const QmlJS::ModelManagerInterface::ProjectInfo &i
     connect(process, &QProcess::errorOccurred, this, &PluginDumper::qmlPluginTypeDumpError);
     process->start(info.qmlDumpPath, arguments);
     m_runningQmldumps.insert(process, importPath);
+    if (!cacheFilePath.isEmpty())
+        m_dumpCacheFiles.insert(process, cacheFilePath);
+}
+
+/*!
+ * \brief Build the cache file path for the dump of \a plugin.
+ * \return the cache file path, or an empty string if the plugin libraries
+ *         cannot be fingerprinted
+ *
+ * The file name encodes the import, the qmldump binary and the size and
+ * modification time of every plugin library, so a changed plugin or a
+ * different Qt version ends up in a different cache file.
+ */
+QString PluginDumper::dumpCacheFilePath(const Plugin &plugin,
+                                        const QmlJS::ModelManagerInterface::ProjectInfo &info)
+{
+    const Snapshot snapshot = m_modelManager->snapshot();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(plugin.importUri.toUtf8());
+    hash.addData(plugin.importVersion.toUtf8());
+    hash.addData(info.qmlDumpPath.toUtf8());
+    hash.addData(QByteArray::number(
+                     QFileInfo(info.qmlDumpPath).lastModified().toMSecsSinceEpoch()));
+
+    bool hasPluginLibrary = false;
+    foreach (const QmlDirParser::Plugin &qmldirPlugin,
+             snapshot.libraryInfo(plugin.qmldirPath).plugins()) {
+        const QString pluginLibrary = resolvePlugin(plugin.qmldirPath, qmldirPlugin.path,
+                                                    qmldirPlugin.name);
+        if (pluginLibrary.isEmpty())
+            continue;
+        const QFileInfo fileInfo(pluginLibrary);
+        hash.addData(pluginLibrary.toUtf8());
+        hash.addData(QByteArray::number(fileInfo.size()));
+        hash.addData(QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch()));
+        hasPluginLibrary = true;
+    }
+    if (!hasPluginLibrary)
+        return QString();
+
+    const QString cacheDirectory
+            = QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            + QLatin1String("/qmljs/plugindumps");
+    if (!QDir().mkpath(cacheDirectory))
+        return QString();
+
+    return cacheDirectory + QLatin1Char('/') + QString::fromLatin1(hash.result().toHex())
+            + QLatin1String(".qmltypes");
+}
+
+bool PluginDumper::loadPluginDumpFromCache(const Plugin &plugin, const QString &cacheFilePath)
+{
+    if (cacheFilePath.isEmpty())
+        return false;
+
+    QFile cacheFile(cacheFilePath);
+    if (!cacheFile.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArray output = cacheFile.readAll();
+
+    QString error;
+    QString warning;
+    CppQmlTypesLoader::BuiltinObjects objectsList;
+    QList<ModuleApiInfo> moduleApis;
+    QStringList dependencies;
+    CppQmlTypesLoader::parseQmlTypeDescriptions(output, &objectsList, &moduleApis, &dependencies,
+                                                &error, &warning,
+                                                QLatin1String("<cached dump of ")
+                                                + plugin.qmldirPath + QLatin1Char('>'));
+    if (!error.isEmpty()) {
+        cacheFile.remove(); // the cache entry is broken, redump
+        return false;
+    }
+
+    const Snapshot snapshot = m_modelManager->snapshot();
+    LibraryInfo libraryInfo = snapshot.libraryInfo(plugin.qmldirPath);
+    libraryInfo.setMetaObjects(objectsList.values());
+    libraryInfo.setModuleApis(moduleApis);
+    libraryInfo.setPluginTypeInfoStatus(LibraryInfo::DumpDone);
+    libraryInfo.updateFingerprint();
+    m_modelManager->updateLibraryInfo(plugin.qmldirPath, libraryInfo);
+
+    if (!warning.isEmpty())
+        printParseWarnings(plugin.qmldirPath, warning);
+
+    return true;
 }
 
 void PluginDumper::dump(const Plugin &plugin)
@@ -566,13 +666,20 @@ void PluginDumper::dump(const Plugin &plugin)
         return;
     }
 
+    // An unchanged plugin dumped with the same qmldump produces the same
+    // output, so replay the cached dump of a previous session instead of
+    // paying for a qmlplugindump run per module on every start.
+    const QString cacheFilePath = dumpCacheFilePath(plugin, info);
+    if (loadPluginDumpFromCache(plugin, cacheFilePath))
+        return;
+
     QStringList args;
     if (info.qmlDumpHasRelocatableFlag)
         args << QLatin1String("-nonrelocatable");
     args << plugin.importUri;
     args << plugin.importVersion;
     args << (plugin.importPath.isEmpty() ? QLatin1String(".") : plugin.importPath);
-    runQmlDump(info, args, plugin.qmldirPath);
+    runQmlDump(info, args, plugin.qmldirPath, cacheFilePath);
 }
 
 /*!
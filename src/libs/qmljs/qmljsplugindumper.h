@@ -73,8 +73,12 @@ private:
         QStringList typeInfoPaths;
     };
 
-    void runQmlDump(const QmlJS::ModelManagerInterface::ProjectInfo &info, const QStringList &arguments, const QString &importPath);
+    void runQmlDump(const QmlJS::ModelManagerInterface::ProjectInfo &info, const QStringList &arguments,
+                    const QString &importPath, const QString &cacheFilePath = QString());
     void dump(const Plugin &plugin);
+    QString dumpCacheFilePath(const Plugin &plugin,
+                              const QmlJS::ModelManagerInterface::ProjectInfo &info);
+    bool loadPluginDumpFromCache(const Plugin &plugin, const QString &cacheFilePath);
     void loadQmlTypeDescription(const QStringList &path, QStringList &errors, QStringList &warnings,
                                 QList<LanguageUtils::FakeMetaObject::ConstPtr> &objects,
                                 QList<ModuleApiInfo> *moduleApi,
@@ -100,6 +104,7 @@ private:
     ModelManagerInterface *m_modelManager;
     Utils::FileSystemWatcher *m_pluginWatcher;
     QHash<QProcess *, QString> m_runningQmldumps;
+    QHash<QProcess *, QString> m_dumpCacheFiles;
     QList<Plugin> m_plugins;
     QHash<QString, int> m_libraryToPluginIndex;
     QHash<QString, QmlJS::ModelManagerInterface::ProjectInfo> m_qtToInfo;
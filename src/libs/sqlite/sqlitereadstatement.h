@@ -38,6 +38,7 @@ public:
     using SqliteStatement::reset;
     using SqliteStatement::value;
     using SqliteStatement::text;
+    using SqliteStatement::textView;
     using SqliteStatement::values;
     using SqliteStatement::columnCount;
     using SqliteStatement::columnNames;
@@ -47,6 +47,7 @@ public:
     using SqliteStatement::bindingColumnNames;
     using SqliteStatement::value;
     using SqliteStatement::text;
+    using SqliteStatement::textView;
     using SqliteStatement::values;
     using SqliteStatement::columnCount;
     using SqliteStatement::columnNames;
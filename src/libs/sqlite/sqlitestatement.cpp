@@ -143,6 +143,10 @@ void SqliteStatement::step() const
 void SqliteStatement::execute() const
 {
     next();
+    // Resetting right away releases the implicit locks and row state, so the
+    // compiled statement can be rebound and executed for the next row of a
+    // batch without an extra round through the prepare cache.
+    reset();
 }
 
 int SqliteStatement::columnCount() const
@@ -385,6 +389,28 @@ static Utils::SmallString convertToTextForColumn(sqlite3_stmt *sqlStatment, int
     Q_UNREACHABLE();
 }
 
+static Utils::SmallStringView textViewForColumn(sqlite3_stmt *sqlStatment, int column)
+{
+    const char *text =  reinterpret_cast<const char*>(sqlite3_column_text(sqlStatment, column));
+    std::size_t size = std::size_t(sqlite3_column_bytes(sqlStatment, column));
+
+    return Utils::SmallStringView(text, size);
+}
+
+static Utils::SmallStringView convertToTextViewForColumn(sqlite3_stmt *sqlStatment, int column)
+{
+    int dataType = sqlite3_column_type(sqlStatment, column);
+    switch (dataType) {
+        case SQLITE_INTEGER:
+        case SQLITE_FLOAT:
+        case SQLITE3_TEXT: return textViewForColumn(sqlStatment, column);
+        case SQLITE_BLOB:
+        case SQLITE_NULL: return Utils::SmallStringView("");
+    }
+
+    Q_UNREACHABLE();
+}
+
 template<>
 int SqliteStatement::value<int>(int column) const
 {
@@ -417,11 +443,24 @@ Utils::SmallString SqliteStatement::value<Utils::SmallString>(int column) const
     return convertToTextForColumn(m_compiledStatement.get(), column);
 }
 
+template<>
+Utils::SmallStringView SqliteStatement::value<Utils::SmallStringView>(int column) const
+{
+    checkIfIsReadyToFetchValues();
+    checkColumnIsValid(column);
+    return convertToTextViewForColumn(m_compiledStatement.get(), column);
+}
+
 Utils::SmallString SqliteStatement::text(int column) const
 {
     return value<Utils::SmallString>(column);
 }
 
+Utils::SmallStringView SqliteStatement::textView(int column) const
+{
+    return value<Utils::SmallStringView>(column);
+}
+
 template <typename ContainerType>
 ContainerType SqliteStatement::columnValues(const std::vector<int> &columnIndices) const
 {
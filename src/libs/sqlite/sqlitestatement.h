@@ -57,6 +57,9 @@ protected:
     template<typename Type>
     Type value(int column) const;
     Utils::SmallString text(int column) const;
+    // The view points into sqlite's column buffer and is only valid until
+    // the next call of next(), reset() or a value fetch for the same column.
+    Utils::SmallStringView textView(int column) const;
     int columnCount() const;
     Utils::SmallStringVector columnNames() const;
 
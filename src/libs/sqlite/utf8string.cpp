@@ -56,8 +56,11 @@ Utf8StringVector Utf8String::split(char separator) const
 {
     Utf8StringVector utf8Vector;
 
-    for (const QByteArray &byteArrayPart : byteArray.split(separator))
-        utf8Vector.append(Utf8String::fromByteArray(byteArrayPart));
+    QList<QByteArray> byteArrayParts = byteArray.split(separator);
+    utf8Vector.reserve(byteArrayParts.count());
+
+    for (QByteArray &byteArrayPart : byteArrayParts)
+        utf8Vector.append(Utf8String::fromByteArray(std::move(byteArrayPart)));
 
     return utf8Vector;
 }
@@ -34,6 +34,7 @@
 #include <QString>
 
 #include <iosfwd>
+#include <utility>
 
 class Utf8StringVector;
 class Utf8String;
@@ -74,6 +75,11 @@ public:
     {
         return Utf8String(utf8ByteArray);
     }
+
+    static Utf8String fromByteArray(QByteArray &&utf8ByteArray)
+    {
+        return Utf8String(std::move(utf8ByteArray));
+    }
     const QByteArray &toByteArray() const
     {
         return byteArray;
@@ -261,6 +267,11 @@ protected:
     {
     }
 
+    explicit Utf8String(QByteArray &&utf8ByteArray)
+        : byteArray(std::move(utf8ByteArray))
+    {
+    }
+
 private:
     QByteArray byteArray;
 };
@@ -272,8 +272,10 @@ void SshOutgoingPacket::generateWindowAdjustPacket(quint32 remoteChannel,
 void SshOutgoingPacket::generateChannelDataPacket(quint32 remoteChannel,
     const QByteArray &data)
 {
-    init(SSH_MSG_CHANNEL_DATA).appendInt(remoteChannel).appendString(data)
-        .finalize();
+    init(SSH_MSG_CHANNEL_DATA);
+    m_data.reserve(m_data.size() + 2 * sizeof(quint32) + data.size()
+                   + 2 * sizeDivisor() + macLength());
+    appendInt(remoteChannel).appendString(data).finalize();
 }
 
 void SshOutgoingPacket::generateChannelSignalPacket(quint32 remoteChannel,
@@ -342,7 +344,11 @@ SshOutgoingPacket &SshOutgoingPacket::appendBool(bool b)
 
 SshOutgoingPacket &SshOutgoingPacket::appendString(const QByteArray &string)
 {
-    m_data.append(encodeString(string));
+    // Encode in place; going through encodeString() would copy the string
+    // twice, which is noticeable for channel data packets.
+    const quint32 lengthBe = qToBigEndian(quint32(string.size()));
+    m_data.append(reinterpret_cast<const char *>(&lengthBe), sizeof lengthBe);
+    m_data.append(string);
     return *this;
 }
 
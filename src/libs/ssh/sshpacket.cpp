@@ -133,8 +133,10 @@ QByteArray AbstractSshPacket::generateMac(const SshAbstractCryptoFacility &crypt
     quint32 seqNr) const
 {
     const quint32 seqNrBe = qToBigEndian(seqNr);
-    QByteArray data(reinterpret_cast<const char *>(&seqNrBe), sizeof seqNrBe);
-    data += QByteArray(m_data.constData(), length() + 4);
+    QByteArray data;
+    data.reserve(sizeof seqNrBe + length() + 4);
+    data.append(reinterpret_cast<const char *>(&seqNrBe), sizeof seqNrBe);
+    data.append(m_data.constData(), length() + 4);
     return crypt.generateMac(data, data.size());
 }
 
@@ -586,8 +586,8 @@ void NodeUpdater::calculateDistances()
     m_expandedDistances.resize(numItems);
     QVarLengthArray<qint64> startsPerExpandedRow(m_model->expandedRowCount());
     QVarLengthArray<qint64> startsPerCollapsedRow(m_model->collapsedRowCount());
-    memset(startsPerCollapsedRow.data(), 0xff, startsPerCollapsedRow.size());
-    memset(startsPerExpandedRow.data(), 0xff, startsPerExpandedRow.size());
+    memset(startsPerCollapsedRow.data(), 0xff, startsPerCollapsedRow.size() * sizeof(qint64));
+    memset(startsPerExpandedRow.data(), 0xff, startsPerExpandedRow.size() * sizeof(qint64));
     for (int i = m_indexFrom; i < m_indexTo; ++i) {
         // Add some "random" factor. Distances below 256ns cannot be properly displayed
         // anyway and if all events have the same distance from one another, then we'd merge
@@ -610,11 +610,14 @@ void NodeUpdater::calculateDistances()
         expandedStart = start;
     }
 
+    // Only the distance at the cut-off position is needed; partitioning is
+    // linear in the number of items while a full sort shows up noticeably
+    // when zooming out over millions of events.
     QVarLengthArray<qint64> sorted = m_collapsedDistances;
-    std::sort(sorted.begin(), sorted.end());
+    std::nth_element(sorted.begin(), sorted.end() - s_maxNumItems, sorted.end());
     m_minCollapsedDistance = sorted[numItems - s_maxNumItems];
     sorted = m_expandedDistances;
-    std::sort(sorted.begin(), sorted.end());
+    std::nth_element(sorted.begin(), sorted.end() - s_maxNumItems, sorted.end());
     m_minExpandedDistance = sorted[numItems - s_maxNumItems];
 }
 
@@ -82,6 +82,17 @@ QList<FormattedText> AnsiEscapeCodeHandler::parseText(const FormattedText &input
     };
 
     const QString escape = QLatin1String("\x1b[");
+
+    // Shortcut for the common case: no control sequence pending from the
+    // previous chunk and no escape character in this one. The scan loop
+    // below would just pass the text through unchanged, at the cost of
+    // repeatedly copying the tail of the string.
+    if (m_pendingText.isEmpty() && !input.text.isEmpty() && !input.text.contains(escape.at(0))) {
+        return QList<FormattedText>()
+                << FormattedText(input.text,
+                                 m_previousFormatClosed ? input.format : m_previousFormat);
+    }
+
     const QChar semicolon       = QLatin1Char(';');
     const QChar colorTerminator = QLatin1Char('m');
     const QChar eraseToEol      = QLatin1Char('K');
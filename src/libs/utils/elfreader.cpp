@@ -26,8 +26,12 @@
 #include "elfreader.h"
 #include "qtcassert.h"
 
+#include <QDateTime>
 #include <QDir>
 #include <QDebug>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 
 #include <new> // std::bad_alloc
 
@@ -347,6 +351,45 @@ QByteArray ElfReader::readCoreName(bool *isCore)
     return QByteArray();
 }
 
+ElfData ElfReader::cachedHeaders(const QString &binary)
+{
+    // Debugger attach and module examination read the same set of shared
+    // libraries over and over; the parsed headers are small, so keep them
+    // around, keyed by path and invalidated by modification time and size.
+    struct CacheEntry
+    {
+        QDateTime mtime;
+        qint64 size = 0;
+        ElfData data;
+    };
+    static QMutex mutex;
+    static QHash<QString, CacheEntry> cache;
+    const int maxCacheSize = 1000;
+
+    const QFileInfo fi(binary);
+    const QDateTime mtime = fi.lastModified();
+    const qint64 size = fi.size();
+
+    {
+        QMutexLocker locker(&mutex);
+        const auto it = cache.constFind(binary);
+        if (it != cache.constEnd() && it.value().mtime == mtime && it.value().size == size)
+            return it.value().data;
+    }
+
+    ElfReader reader(binary);
+    const ElfData data = reader.readHeaders(); // without holding the lock
+
+    QMutexLocker locker(&mutex);
+    if (cache.size() >= maxCacheSize)
+        cache.clear();
+    CacheEntry &entry = cache[binary];
+    entry.mtime = mtime;
+    entry.size = size;
+    entry.data = data;
+    return data;
+}
+
 int ElfData::indexOf(const QByteArray &name) const
 {
     for (int i = 0, n = sectionHeaders.size(); i != n; ++i)
@@ -165,6 +165,12 @@ public:
     QString errorString() const { return m_errorString; }
     QByteArray readCoreName(bool *isCore);
 
+    // Returns the headers of the binary from a process-wide cache keyed by
+    // file path, modification time and size. Thread-safe. Use this when the
+    // same binaries are examined repeatedly, e.g. the modules of a debugged
+    // process across sessions.
+    static ElfData cachedHeaders(const QString &binary);
+
 private:
     friend class ElfMapper;
     Result readIt();
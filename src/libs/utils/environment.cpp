@@ -476,10 +476,10 @@ int Environment::size() const
 
 void Environment::modify(const QList<EnvironmentItem> & list)
 {
-    Environment resultEnvironment = *this;
+    // Applying in place spares the full detach of the map that a temporary
+    // copy would force as soon as the first item is applied.
     for (const EnvironmentItem &item : list)
-        item.apply(&resultEnvironment);
-    *this = resultEnvironment;
+        item.apply(this);
 }
 
 QList<EnvironmentItem> Environment::diff(const Environment &other, bool checkAppendPrepend) const
@@ -93,6 +93,7 @@ void FileInProjectFinder::setProjectFiles(const QStringList &projectFiles)
         return;
 
     m_projectFiles = projectFiles;
+    m_filesByName.clear();
     m_cache.clear();
 }
 
@@ -291,12 +292,14 @@ bool FileInProjectFinder::findInSearchPath(const QString &searchPath, QString *f
 
 QStringList FileInProjectFinder::filesWithSameFileName(const QString &fileName) const
 {
-    QStringList result;
-    foreach (const QString &f, m_projectFiles) {
-        if (FileName::fromString(f).fileName() == fileName)
-            result << f;
+    // QML profiling and breakpoint resolution look up thousands of locations,
+    // so walking all project files and splitting off their file names on
+    // every call adds up. Index the project files by file name once instead.
+    if (m_filesByName.isEmpty() && !m_projectFiles.isEmpty()) {
+        foreach (const QString &f, m_projectFiles)
+            m_filesByName[FileName::fromString(f).fileName()].append(f);
     }
-    return result;
+    return m_filesByName.value(fileName);
 }
 
 int FileInProjectFinder::rankFilePath(const QString &candidatePath, const QString &filePathToFind)
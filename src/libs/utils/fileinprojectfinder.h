@@ -62,6 +62,7 @@ private:
     QStringList m_projectFiles;
     QStringList m_searchDirectories;
     mutable QHash<QString,QString> m_cache;
+    mutable QHash<QString,QStringList> m_filesByName; // built lazily from m_projectFiles
 };
 
 } // namespace Utils
@@ -33,8 +33,10 @@
 #include <QRegExp>
 #include <QRegularExpression>
 #include <QTextCodec>
+#include <QThreadPool>
 
 #include <cctype>
+#include <cstring>
 
 using namespace Utils;
 
@@ -90,6 +92,12 @@ public:
                     const FileIterator::Item &item) const;
 
 private:
+    void searchInLine(const QString &chunk, int lineNr, const QString &filePath,
+                      FileSearchResultList *results) const;
+    bool processMapped(QFutureInterface<FileSearchResultList> &futureInterface,
+                       const FileIterator::Item &item, FileSearchResultList *results) const;
+    const char *findTerm(const char *begin, const char *end) const;
+
     QMap<QString, QString> fileToContentsMap;
     QString searchTermLower;
     QString searchTermUpper;
@@ -97,6 +105,10 @@ private:
     const QChar *termData;
     const QChar *termDataLower;
     const QChar *termDataUpper;
+    QByteArray termAscii;
+    QByteArray termAsciiLower;
+    QByteArray termAsciiUpper;
+    bool termIsAscii;
     bool caseSensitive;
     bool wholeWord;
 };
@@ -130,6 +142,185 @@ FileSearch::FileSearch(const QString &searchTerm, QTextDocument::FindFlags flags
     termData = searchTerm.constData();
     termDataLower = searchTermLower.constData();
     termDataUpper = searchTermUpper.constData();
+    termIsAscii = !searchTerm.isEmpty()
+            && Utils::allOf(searchTerm, [](QChar c) { return c.unicode() < 128; });
+    if (termIsAscii) {
+        termAscii = searchTerm.toLatin1();
+        termAsciiLower = searchTermLower.toLatin1();
+        termAsciiUpper = searchTermUpper.toLatin1();
+    }
+}
+
+void FileSearch::searchInLine(const QString &chunk, int lineNr, const QString &filePath,
+                              FileSearchResultList *results) const
+{
+    const QString resultItemText = clippedText(chunk, MAX_LINE_SIZE);
+    int chunkLength = chunk.length();
+    const QChar *chunkPtr = chunk.constData();
+    const QChar *chunkEnd = chunkPtr + chunkLength - 1;
+    for (const QChar *regionPtr = chunkPtr; regionPtr + termMaxIndex <= chunkEnd; ++regionPtr) {
+        const QChar *regionEnd = regionPtr + termMaxIndex;
+        if ( /* optimization check for start and end of region */
+                // case sensitive
+                (caseSensitive && *regionPtr == termData[0]
+                 && *regionEnd == termData[termMaxIndex])
+                ||
+                // case insensitive
+                (!caseSensitive && (*regionPtr == termDataLower[0]
+                                    || *regionPtr == termDataUpper[0])
+                 && (*regionEnd == termDataLower[termMaxIndex]
+                     || *regionEnd == termDataUpper[termMaxIndex]))
+                 ) {
+            bool equal = true;
+
+            // whole word check
+            const QChar *beforeRegion = regionPtr - 1;
+            const QChar *afterRegion = regionEnd + 1;
+            if (wholeWord
+                    && (((beforeRegion >= chunkPtr)
+                         && (beforeRegion->isLetterOrNumber()
+                             || ((*beforeRegion) == QLatin1Char('_'))))
+                        ||
+                        ((afterRegion <= chunkEnd)
+                         && (afterRegion->isLetterOrNumber()
+                             || ((*afterRegion) == QLatin1Char('_'))))
+                        )) {
+                equal = false;
+            } else {
+                // check all chars
+                int regionIndex = 1;
+                for (const QChar *regionCursor = regionPtr + 1;
+                     regionCursor < regionEnd;
+                     ++regionCursor, ++regionIndex) {
+                    if (  // case sensitive
+                          (caseSensitive
+                           && *regionCursor != termData[regionIndex])
+                          ||
+                          // case insensitive
+                          (!caseSensitive
+                           && *regionCursor != termDataLower[regionIndex]
+                           && *regionCursor != termDataUpper[regionIndex])
+                          ) {
+                        equal = false;
+                    }
+                }
+            }
+            if (equal) {
+                *results << FileSearchResult(filePath, lineNr, resultItemText,
+                                             regionPtr - chunkPtr, termMaxIndex + 1,
+                                             QStringList());
+                regionPtr += termMaxIndex; // another +1 done by for-loop
+            }
+        }
+    }
+}
+
+// Returns the first occurrence of the term's bytes between begin and end,
+// folding case for pure-ASCII terms, or null. Used as a cheap prefilter on
+// the raw file contents; a hit is verified on the decoded line.
+const char *FileSearch::findTerm(const char *begin, const char *end) const
+{
+    const int termLength = termMaxIndex + 1;
+    const char *last = end - termLength;
+    if (caseSensitive) {
+        const char *cursor = begin;
+        while (cursor <= last) {
+            cursor = static_cast<const char *>(
+                        memchr(cursor, termAscii.at(0), last - cursor + 1));
+            if (!cursor)
+                return 0;
+            if (memcmp(cursor, termAscii.constData(), termLength) == 0)
+                return cursor;
+            ++cursor;
+        }
+        return 0;
+    }
+    const char firstLower = termAsciiLower.at(0);
+    const char firstUpper = termAsciiUpper.at(0);
+    for (const char *cursor = begin; cursor <= last; ++cursor) {
+        if (*cursor != firstLower && *cursor != firstUpper)
+            continue;
+        int i = 1;
+        while (i < termLength
+               && (cursor[i] == termAsciiLower.at(i) || cursor[i] == termAsciiUpper.at(i))) {
+            ++i;
+        }
+        if (i == termLength)
+            return cursor;
+    }
+    return 0;
+}
+
+// Memory-mapped fast path: scans the raw bytes for occurrences of the term
+// and establishes line boundaries only around actual hits, so files without
+// a match are processed in a single pass over the buffer. Usable for
+// pure-ASCII terms in byte-oriented encodings, where the term's bytes cannot
+// occur inside a multi-byte sequence; everything else falls back to the
+// stream-based path. Returns false if this file could not be handled here.
+bool FileSearch::processMapped(QFutureInterface<FileSearchResultList> &futureInterface,
+                               const FileIterator::Item &item,
+                               FileSearchResultList *results) const
+{
+    if (!termIsAscii || !item.encoding)
+        return false;
+    if (termAscii.contains('\n') || termAscii.contains('\r'))
+        return false; // QTextStream::readLine never reports these
+    const QByteArray codecName = item.encoding->name();
+    if (codecName != "UTF-8" && codecName != "ISO-8859-1" && codecName != "US-ASCII")
+        return false;
+    QFile file(item.filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    const qint64 size = file.size();
+    const uchar *mapped = size > 0 ? file.map(0, size) : 0;
+    if (!mapped && size > 0)
+        return false;
+
+    const char *cursor = reinterpret_cast<const char *>(mapped);
+    const char *end = cursor + size;
+    if (size >= 2 && (memcmp(cursor, "\xff\xfe", 2) == 0 || memcmp(cursor, "\xfe\xff", 2) == 0
+                      || memcmp(cursor, "\x00\x00", 2) == 0)) {
+        return false; // UTF-16/32 byte order mark, QTextStream will switch codecs
+    }
+    if (codecName == "UTF-8" && size >= 3
+            && memcmp(cursor, "\xef\xbb\xbf", 3) == 0) {
+        cursor += 3; // skip the byte order mark, as QTextStream would
+    }
+
+    for (const char *cr = cursor; cr < end; ++cr) {
+        cr = static_cast<const char *>(memchr(cr, '\r', end - cr));
+        if (!cr)
+            break;
+        if (cr + 1 == end || *(cr + 1) != '\n')
+            return false; // old Mac line endings, let QTextStream deal with them
+    }
+
+    FileSearchResultList mappedResults;
+    int lineNr = 1;
+    const char *lineStart = cursor;
+    while (const char *hit = findTerm(cursor, end)) {
+        const char *newline;
+        while ((newline = static_cast<const char *>(memchr(lineStart, '\n', hit - lineStart)))) {
+            ++lineNr;
+            lineStart = newline + 1;
+        }
+        newline = static_cast<const char *>(memchr(hit, '\n', end - hit));
+        const char *lineEnd = newline ? newline : end;
+        const char *contentEnd = (lineEnd > lineStart && *(lineEnd - 1) == '\r') ? lineEnd - 1
+                                                                                 : lineEnd;
+        const QString chunk = item.encoding->toUnicode(lineStart, contentEnd - lineStart);
+        searchInLine(chunk, lineNr, item.filePath, &mappedResults);
+        if (!newline)
+            break;
+        cursor = lineStart = newline + 1;
+        ++lineNr;
+        if (futureInterface.isPaused())
+            futureInterface.waitForResume();
+        if (futureInterface.isCanceled())
+            break;
+    }
+    *results += mappedResults;
+    return true;
 }
 
 void FileSearch::operator()(QFutureInterface<FileSearchResultList> &futureInterface,
@@ -140,6 +331,15 @@ void FileSearch::operator()(QFutureInterface<FileSearchResultList> &futureInterf
     futureInterface.setProgressRange(0, 1);
     futureInterface.setProgressValue(0);
     FileSearchResultList results;
+    if (!fileToContentsMap.contains(item.filePath)
+            && processMapped(futureInterface, item, &results)) {
+        if (!futureInterface.isCanceled()) {
+            futureInterface.reportResult(results);
+            futureInterface.setProgressValue(1);
+        }
+        return;
+    }
+    results.clear();
     QFile file;
     QTextStream stream;
     QString tempString;
@@ -152,65 +352,7 @@ void FileSearch::operator()(QFutureInterface<FileSearchResultList> &futureInterf
     while (!stream.atEnd()) {
         ++lineNr;
         const QString chunk = stream.readLine();
-        const QString resultItemText = clippedText(chunk, MAX_LINE_SIZE);
-        int chunkLength = chunk.length();
-        const QChar *chunkPtr = chunk.constData();
-        const QChar *chunkEnd = chunkPtr + chunkLength - 1;
-        for (const QChar *regionPtr = chunkPtr; regionPtr + termMaxIndex <= chunkEnd; ++regionPtr) {
-            const QChar *regionEnd = regionPtr + termMaxIndex;
-            if ( /* optimization check for start and end of region */
-                    // case sensitive
-                    (caseSensitive && *regionPtr == termData[0]
-                     && *regionEnd == termData[termMaxIndex])
-                    ||
-                    // case insensitive
-                    (!caseSensitive && (*regionPtr == termDataLower[0]
-                                        || *regionPtr == termDataUpper[0])
-                     && (*regionEnd == termDataLower[termMaxIndex]
-                         || *regionEnd == termDataUpper[termMaxIndex]))
-                     ) {
-                bool equal = true;
-
-                // whole word check
-                const QChar *beforeRegion = regionPtr - 1;
-                const QChar *afterRegion = regionEnd + 1;
-                if (wholeWord
-                        && (((beforeRegion >= chunkPtr)
-                             && (beforeRegion->isLetterOrNumber()
-                                 || ((*beforeRegion) == QLatin1Char('_'))))
-                            ||
-                            ((afterRegion <= chunkEnd)
-                             && (afterRegion->isLetterOrNumber()
-                                 || ((*afterRegion) == QLatin1Char('_'))))
-                            )) {
-                    equal = false;
-                } else {
-                    // check all chars
-                    int regionIndex = 1;
-                    for (const QChar *regionCursor = regionPtr + 1;
-                         regionCursor < regionEnd;
-                         ++regionCursor, ++regionIndex) {
-                        if (  // case sensitive
-                              (caseSensitive
-                               && *regionCursor != termData[regionIndex])
-                              ||
-                              // case insensitive
-                              (!caseSensitive
-                               && *regionCursor != termDataLower[regionIndex]
-                               && *regionCursor != termDataUpper[regionIndex])
-                              ) {
-                            equal = false;
-                        }
-                    }
-                }
-                if (equal) {
-                    results << FileSearchResult(item.filePath, lineNr, resultItemText,
-                                                regionPtr - chunkPtr, termMaxIndex + 1,
-                                                QStringList());
-                    regionPtr += termMaxIndex; // another +1 done by for-loop
-                }
-            }
-        }
+        searchInLine(chunk, lineNr, item.filePath, &results);
         if (futureInterface.isPaused())
             futureInterface.waitForResume();
         if (futureInterface.isCanceled())
@@ -357,6 +499,24 @@ void cleanUpFileSearch(QFutureInterface<FileSearchResultList> &futureInterface,
     delete state.files;
 }
 
+// The pool shared by all file searches. Workers take the next file from the
+// iterator as soon as they finish their current one, so a directory of huge
+// files cannot starve the other threads. The worker count follows the number
+// of cores and can be overridden with QTC_FILESEARCH_THREAD_COUNT.
+QThreadPool *searchThreadPool()
+{
+    static QThreadPool pool;
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        bool ok = false;
+        const int threadCount = qgetenv("QTC_FILESEARCH_THREAD_COUNT").toInt(&ok);
+        if (ok && threadCount > 0)
+            pool.setMaxThreadCount(threadCount);
+    }
+    return &pool;
+}
+
 } // namespace
 
 QFuture<FileSearchResultList> Utils::findInFiles(const QString &searchTerm, FileIterator *files,
@@ -368,7 +528,8 @@ QFuture<FileSearchResultList> Utils::findInFiles(const QString &searchTerm, File
                      },
                      FileSearch(searchTerm, flags, fileToContentsMap),
                      &collectSearchResults,
-                     &cleanUpFileSearch);
+                     &cleanUpFileSearch,
+                     MapReduceOption::Ordered, searchThreadPool());
 }
 
 QFuture<FileSearchResultList> Utils::findInFilesRegExp(const QString &searchTerm, FileIterator *files,
@@ -380,7 +541,8 @@ QFuture<FileSearchResultList> Utils::findInFilesRegExp(const QString &searchTerm
                      },
                      FileSearchRegExp(searchTerm, flags, fileToContentsMap),
                      &collectSearchResults,
-                     &cleanUpFileSearch);
+                     &cleanUpFileSearch,
+                     MapReduceOption::Ordered, searchThreadPool());
 }
 
 QString Utils::expandRegExpReplacement(const QString &replaceText, const QStringList &capturedTexts)
@@ -91,8 +91,10 @@ public:
 
     quint64 maxFileOpen;
     int m_objectCount;
-    QHash<QString, int> m_fileCount;
-    QHash<QString, int> m_directoryCount;
+    // Watcher instances interested in a path. The list size doubles as the
+    // reference count deciding when the path is (un)registered in m_watcher.
+    QHash<QString, QList<FileSystemWatcher *> > m_fileWatchers;
+    QHash<QString, QList<FileSystemWatcher *> > m_directoryWatchers;
     QFileSystemWatcher *m_watcher;
 };
 
@@ -188,15 +190,31 @@ void FileSystemWatcher::init()
     d->m_staticData = &it.value();
 
     if (!d->m_staticData->m_watcher) {
-        d->m_staticData->m_watcher = new QFileSystemWatcher();
+        QFileSystemWatcher *watcher = new QFileSystemWatcher();
+        d->m_staticData->m_watcher = watcher;
+        // Dispatch events only to the instances watching the path instead of
+        // fanning each one out to every instance sharing the watcher. A slot
+        // may (indirectly) delete other instances, so recheck the registry
+        // before each delivery.
+        FileSystemWatcherStaticData *staticData = d->m_staticData;
+        connect(watcher, &QFileSystemWatcher::fileChanged, watcher,
+                [staticData](const QString &path) {
+            foreach (FileSystemWatcher *w, staticData->m_fileWatchers.value(path)) {
+                if (staticData->m_fileWatchers.value(path).contains(w))
+                    w->slotFileChanged(path);
+            }
+        });
+        connect(watcher, &QFileSystemWatcher::directoryChanged, watcher,
+                [staticData](const QString &path) {
+            foreach (FileSystemWatcher *w, staticData->m_directoryWatchers.value(path)) {
+                if (staticData->m_directoryWatchers.value(path).contains(w))
+                    w->slotDirectoryChanged(path);
+            }
+        });
         if (debug)
             qDebug() << this << "Created watcher for id " << d->m_id;
     }
     ++(d->m_staticData->m_objectCount);
-    connect(d->m_staticData->m_watcher, &QFileSystemWatcher::fileChanged,
-            this, &FileSystemWatcher::slotFileChanged);
-    connect(d->m_staticData->m_watcher, &QFileSystemWatcher::directoryChanged,
-            this, &FileSystemWatcher::slotDirectoryChanged);
 }
 
 FileSystemWatcher::~FileSystemWatcher()
@@ -209,8 +227,8 @@ FileSystemWatcher::~FileSystemWatcher()
     if (--(d->m_staticData->m_objectCount) == 0) {
         delete d->m_staticData->m_watcher;
         d->m_staticData->m_watcher = 0;
-        d->m_staticData->m_fileCount.clear();
-        d->m_staticData->m_directoryCount.clear();
+        d->m_staticData->m_fileWatchers.clear();
+        d->m_staticData->m_directoryWatchers.clear();
         if (debug)
               qDebug() << this << "Deleted watcher" << d->m_id;
     }
@@ -248,10 +266,11 @@ void FileSystemWatcher::addFiles(const QStringList &files, WatchMode wm)
 
         d->m_files.insert(file, WatchEntry(file, wm));
 
-        const int count = ++d->m_staticData->m_fileCount[file];
-        Q_ASSERT(count > 0);
+        QList<FileSystemWatcher *> &watchers = d->m_staticData->m_fileWatchers[file];
+        Q_ASSERT(!watchers.contains(this));
+        watchers.append(this);
 
-        if (count == 1)
+        if (watchers.size() == 1)
             toAdd << file;
     }
 
@@ -277,11 +296,12 @@ void FileSystemWatcher::removeFiles(const QStringList &files)
         }
         d->m_files.erase(it);
 
-        const int count = --(d->m_staticData->m_fileCount[file]);
-        Q_ASSERT(count >= 0);
-
-        if (!count)
+        QList<FileSystemWatcher *> &watchers = d->m_staticData->m_fileWatchers[file];
+        watchers.removeOne(this);
+        if (watchers.isEmpty()) {
+            d->m_staticData->m_fileWatchers.remove(file);
             toRemove << file;
+        }
     }
 
     if (!toRemove.isEmpty())
@@ -324,10 +344,11 @@ void FileSystemWatcher::addDirectories(const QStringList &directories, WatchMode
 
         d->m_directories.insert(directory, WatchEntry(directory, wm));
 
-        const int count = ++d->m_staticData->m_directoryCount[directory];
-        Q_ASSERT(count > 0);
+        QList<FileSystemWatcher *> &watchers = d->m_staticData->m_directoryWatchers[directory];
+        Q_ASSERT(!watchers.contains(this));
+        watchers.append(this);
 
-        if (count == 1)
+        if (watchers.size() == 1)
             toAdd << directory;
     }
 
@@ -354,11 +375,12 @@ void FileSystemWatcher::removeDirectories(const QStringList &directories)
         }
         d->m_directories.erase(it);
 
-        const int count = --d->m_staticData->m_directoryCount[directory];
-        Q_ASSERT(count >= 0);
-
-        if (!count)
+        QList<FileSystemWatcher *> &watchers = d->m_staticData->m_directoryWatchers[directory];
+        watchers.removeOne(this);
+        if (watchers.isEmpty()) {
+            d->m_staticData->m_directoryWatchers.remove(directory);
             toRemove << directory;
+        }
     }
     if (!toRemove.isEmpty())
         d->m_staticData->m_watcher->removePaths(toRemove);
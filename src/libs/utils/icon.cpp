@@ -35,6 +35,7 @@
 #include <QMetaEnum>
 #include <QPainter>
 #include <QPaintEngine>
+#include <QPixmapCache>
 #include <QWidget>
 #include <QDebug>
 
@@ -45,6 +46,17 @@ static const qreal PunchEdgeIntensity = 0.6;
 
 static QPixmap maskToColorAndAlpha(const QPixmap &mask, const QColor &color)
 {
+    // The icons are composed from a small set of mask images which get
+    // colorized over and over with the same few theme colors while the tool
+    // bars are constructed. Cache the result. Masks loaded from the same file
+    // share their data and therefore their cache key.
+    const QString cacheKey = QLatin1String("qtc_mask_")
+            + QString::number(mask.cacheKey(), 16) + QLatin1Char('_')
+            + QString::number(color.rgba(), 16);
+    QPixmap cached;
+    if (QPixmapCache::find(cacheKey, &cached))
+        return cached;
+
     QImage result(mask.toImage().convertToFormat(QImage::Format_ARGB32));
     result.setDevicePixelRatio(mask.devicePixelRatio());
     QRgb *bitsStart = reinterpret_cast<QRgb*>(result.bits());
@@ -55,7 +67,9 @@ static QPixmap maskToColorAndAlpha(const QPixmap &mask, const QColor &color)
         QRgb pixelAlpha = (((~*pixel) & 0xff) * alpha) >> 8;
         *pixel = (pixelAlpha << 24) | tint;
     }
-    return QPixmap::fromImage(result);
+    const QPixmap pixmap = QPixmap::fromImage(result);
+    QPixmapCache::insert(cacheKey, pixmap);
+    return pixmap;
 }
 
 typedef QPair<QPixmap, QColor> MaskAndColor;
@@ -609,4 +609,29 @@ mapped(Container &&container, MapFunction &&mapFun,
                                              [](const MapResult &r) { return r; });
 }
 
+// Parallel counterpart of Utils::filtered from algorithm.h. The predicate is
+// evaluated concurrently on the thread pool, the items that pass are collected
+// in container order afterwards. The mandatory pool parameter (pass nullptr
+// for the global pool) distinguishes this from the sequential overload.
+template <typename Container, typename Predicate>
+Q_REQUIRED_RESULT
+Container
+filtered(const Container &container, Predicate predicate, QThreadPool *pool,
+         QThread::Priority priority = QThread::InheritPriority)
+{
+    const QList<bool> passes = map(container,
+                                   [&predicate](const typename Container::value_type &item) {
+                                       return bool(predicate(item));
+                                   },
+                                   MapReduceOption::Ordered, pool, priority).results();
+    Container out;
+    auto outIt = inserter(out);
+    int i = 0;
+    for (auto it = container.begin(); it != container.end(); ++it, ++i) {
+        if (passes.at(i))
+            *outIt++ = *it;
+    }
+    return out;
+}
+
 } // Utils
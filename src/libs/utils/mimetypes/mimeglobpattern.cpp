@@ -92,23 +92,59 @@ void MimeGlobMatchResult::addMatch(const QString &mimeType, int weight, const QS
     \sa MimeType, MimeDatabase, MimeMagicRuleMatcher, MimeMagicRule
 */
 
+void MimeGlobPattern::detectPatternType()
+{
+    m_patternType = OtherPattern;
+    const int pattern_len = m_pattern.length();
+    if (!pattern_len)
+        return;
+
+    const int starCount = m_pattern.count(QLatin1Char('*'));
+
+    // Patterns like "*~", "*.extension"
+    if (m_pattern[0] == QLatin1Char('*') && m_pattern.indexOf(QLatin1Char('[')) == -1
+            && starCount == 1) {
+        m_patternType = SuffixPattern;
+        return;
+    }
+
+    // Patterns like "README*" (well this is currently the only one like that...)
+    if (starCount == 1 && m_pattern.at(pattern_len - 1) == QLatin1Char('*')) {
+        m_patternType = PrefixPattern;
+        return;
+    }
+
+    // Names without any wildcards like "README"
+    if (m_pattern.indexOf(QLatin1Char('[')) == -1 && starCount == 0
+            && m_pattern.indexOf(QLatin1Char('?'))) {
+        m_patternType = LiteralPattern;
+        return;
+    }
+
+    // Other (quite rare) patterns, like "*.anim[1-9j]": use slow but correct method
+}
+
 bool MimeGlobPattern::matchFileName(const QString &inputFilename) const
 {
     // "Applications MUST match globs case-insensitively, except when the case-sensitive
     // attribute is set to true."
     // The constructor takes care of putting case-insensitive patterns in lowercase.
     const QString filename = m_caseSensitivity == Qt::CaseInsensitive ? inputFilename.toLower() : inputFilename;
+    return matchPreparedFileName(filename);
+}
 
+// The file name must already be lowercased for case-insensitive patterns;
+// MimeGlobPatternList::match does this once per query instead of once per
+// pattern.
+bool MimeGlobPattern::matchPreparedFileName(const QString &filename) const
+{
     const int pattern_len = m_pattern.length();
     if (!pattern_len)
         return false;
     const int len = filename.length();
 
-    const int starCount = m_pattern.count(QLatin1Char('*'));
-
-    // Patterns like "*~", "*.extension"
-    if (m_pattern[0] == QLatin1Char('*') && m_pattern.indexOf(QLatin1Char('[')) == -1 && starCount == 1)
-    {
+    switch (m_patternType) {
+    case SuffixPattern: {
         if (len + 1 < pattern_len) return false;
 
         const QChar *c1 = m_pattern.unicode() + pattern_len - 1;
@@ -118,9 +154,7 @@ bool MimeGlobPattern::matchFileName(const QString &inputFilename) const
             ++cnt;
         return cnt == pattern_len;
     }
-
-    // Patterns like "README*" (well this is currently the only one like that...)
-    if (starCount == 1 && m_pattern.at(pattern_len - 1) == QLatin1Char('*')) {
+    case PrefixPattern: {
         if (len + 1 < pattern_len) return false;
         if (m_pattern.at(0) == QLatin1Char('*'))
             return filename.indexOf(m_pattern.midRef(1, pattern_len - 2)) != -1;
@@ -132,12 +166,12 @@ bool MimeGlobPattern::matchFileName(const QString &inputFilename) const
            ++cnt;
         return cnt == pattern_len;
     }
-
-    // Names without any wildcards like "README"
-    if (m_pattern.indexOf(QLatin1Char('[')) == -1 && starCount == 0 && m_pattern.indexOf(QLatin1Char('?')))
+    case LiteralPattern:
         return (m_pattern == filename);
+    case OtherPattern:
+        break;
+    }
 
-    // Other (quite rare) patterns, like "*.anim[1-9j]": use slow but correct method
     QRegExp rx(m_pattern, Qt::CaseSensitive, QRegExp::WildcardUnix);
     return rx.exactMatch(filename);
 }
@@ -192,12 +226,15 @@ void MimeAllGlobPatterns::removeMimeType(const QString &mimeType)
 void MimeGlobPatternList::match(MimeGlobMatchResult &result,
                                  const QString &fileName) const
 {
+    QString lowerFileName; // lazily created, most file names hit only case-insensitive patterns
 
     MimeGlobPatternList::const_iterator it = this->constBegin();
     const MimeGlobPatternList::const_iterator endIt = this->constEnd();
     for (; it != endIt; ++it) {
         const MimeGlobPattern &glob = *it;
-        if (glob.matchFileName(fileName))
+        if (!glob.isCaseSensitive() && lowerFileName.isNull())
+            lowerFileName = fileName.toLower();
+        if (glob.matchPreparedFileName(glob.isCaseSensitive() ? fileName : lowerFileName))
             result.addMatch(glob.mimeType(), glob.weight(), glob.pattern());
     }
 }
@@ -83,6 +83,7 @@ public:
         if (s == Qt::CaseInsensitive) {
             m_pattern = m_pattern.toLower();
         }
+        detectPatternType();
     }
     ~MimeGlobPattern() {}
 
@@ -94,10 +95,23 @@ public:
     inline bool isCaseSensitive() const { return m_caseSensitivity == Qt::CaseSensitive; }
 
 private:
+    // The shape of a pattern is determined once at construction time; doing
+    // it in matchFileName() made every query rescan every pattern.
+    enum PatternType {
+        SuffixPattern,  // "*~", "*.extension"
+        PrefixPattern,  // "README*"
+        LiteralPattern, // "README"
+        OtherPattern    // "*.anim[1-9j]" etc., matched with QRegExp
+    };
+    void detectPatternType();
+    bool matchPreparedFileName(const QString &filename) const;
+    friend class MimeGlobPatternList;
+
     QString m_pattern;
     QString m_mimeType;
     int m_weight;
     Qt::CaseSensitivity m_caseSensitivity;
+    PatternType m_patternType;
 };
 
 class MimeGlobPatternList : public QList<MimeGlobPattern>
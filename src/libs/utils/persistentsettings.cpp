@@ -329,6 +329,33 @@ QVariant ParseContext::readSimpleValue(QXmlStreamReader &r, const QXmlStreamAttr
         const QRect rectangle = stringToRectangle(text);
         return rectangle.isValid() ? QVariant(rectangle) : QVariant();
     }
+    // Fast paths for the types that make up nearly all entries of .user and
+    // session files. The generic code below allocates a QByteArray for the
+    // meta type lookup and converts through QVariant's string machinery for
+    // every single value.
+    if (type == QLatin1String("QString"))
+        return QVariant(text);
+    if (type == QLatin1String("bool")) {
+        const QString lower = text.toLower();
+        return QVariant(!(lower.isEmpty() || lower == QLatin1String("false")
+                          || lower == QLatin1String("0")));
+    }
+    if (type == QLatin1String("int")) {
+        bool ok;
+        const int i = text.toInt(&ok);
+        if (ok)
+            return QVariant(i);
+    } else if (type == QLatin1String("qlonglong")) {
+        bool ok;
+        const qlonglong ll = text.toLongLong(&ok);
+        if (ok)
+            return QVariant(ll);
+    } else if (type == QLatin1String("double")) {
+        bool ok;
+        const double dbl = text.toDouble(&ok);
+        if (ok)
+            return QVariant(dbl);
+    }
     QVariant value;
     value.setValue(text);
     value.convert(QMetaType::type(type.toLatin1().data()));
@@ -699,7 +699,9 @@ void QtcProcess::start()
             qWarning("QtcProcess::start: Empty environment set when running '%s'.", qPrintable(m_command));
         env = m_environment;
 
-        QProcess::setEnvironment(env.toStringList());
+        // Hand the environment over directly; the string list setter makes
+        // QProcess re-parse every KEY=VALUE pair on each launch.
+        QProcess::setProcessEnvironment(env.toProcessEnvironment());
     } else {
         env = Environment::systemEnvironment();
     }
@@ -189,15 +189,19 @@ class ChannelBuffer : public QObject
     Q_OBJECT
 
 public:
+    ChannelBuffer();
+
     void clearForRun();
 
     QString linesRead();
     void append(const QByteArray &text, bool emitSignals);
+    void flush();
 
     QByteArray rawData;
     QString incompleteLineBuffer; // lines not yet signaled
     QTextCodec *codec = nullptr; // Not owner
     std::unique_ptr<QTextCodec::ConverterState> codecState;
+    QTimer flushTimer;
     int rawDataPos = 0;
     bool bufferedSignalsEnabled = false;
     bool firstBuffer = true;
@@ -206,6 +210,16 @@ signals:
     void outputBuffered(const QString &text, bool firstTime);
 };
 
+ChannelBuffer::ChannelBuffer()
+{
+    // Coalesce the buffered output signals: a chatty process makes readyRead
+    // fire far more often than the consuming output windows can usefully
+    // repaint, so collect lines for a moment before emitting them in one go.
+    flushTimer.setSingleShot(true);
+    flushTimer.setInterval(50);
+    connect(&flushTimer, &QTimer::timeout, this, &ChannelBuffer::flush);
+}
+
 void ChannelBuffer::clearForRun()
 {
     firstBuffer = true;
@@ -213,6 +227,7 @@ void ChannelBuffer::clearForRun()
     rawData.clear();
     codecState.reset(new QTextCodec::ConverterState);
     incompleteLineBuffer.clear();
+    flushTimer.stop();
 }
 
 /* Check for complete lines read from the device and return them, moving the
@@ -246,13 +261,20 @@ void ChannelBuffer::append(const QByteArray &text, bool emitSignals)
     if (!emitSignals)
         return;
 
-    // Buffered. Emit complete lines?
-    if (bufferedSignalsEnabled) {
-        const QString lines = linesRead();
-        if (!lines.isEmpty()) {
-            emit outputBuffered(lines, firstBuffer);
-            firstBuffer = false;
-        }
+    // Buffered. Emit complete lines, rate limited by the flush timer.
+    if (bufferedSignalsEnabled && !flushTimer.isActive())
+        flushTimer.start();
+}
+
+void ChannelBuffer::flush()
+{
+    if (!bufferedSignalsEnabled)
+        return;
+    flushTimer.stop();
+    const QString lines = linesRead();
+    if (!lines.isEmpty()) {
+        emit outputBuffered(lines, firstBuffer);
+        firstBuffer = false;
     }
 }
 
@@ -461,6 +483,9 @@ SynchronousProcessResponse SynchronousProcess::run(const QString &binary,
         if (isGuiThread())
             QApplication::setOverrideCursor(Qt::WaitCursor);
         d->m_eventLoop.exec(QEventLoop::ExcludeUserInputEvents);
+        // Emit complete lines that are still waiting for the flush timer.
+        d->m_stdOut.flush();
+        d->m_stdErr.flush();
         if (d->m_result.result == SynchronousProcessResponse::Finished || d->m_result.result == SynchronousProcessResponse::FinishedError) {
             processStdOut(false);
             processStdErr(false);
@@ -131,6 +131,25 @@ static bool verifyDecodingError(const QString &text, const QTextCodec *codec,
                       minSize));
 }
 
+// Returns whether the buffer consists of 7-bit ASCII only, checking a
+// machine word at a time.
+static bool isAscii(const char *data, const int size)
+{
+    const quintptr mask = quintptr(Q_UINT64_C(0x8080808080808080));
+    const char *p = data;
+    const char *end = data + size;
+    for ( ; p < end && quintptr(p) % sizeof(quintptr); ++p)
+        if (quint8(*p) & 0x80)
+            return false;
+    for ( ; p + int(sizeof(quintptr)) <= end; p += sizeof(quintptr))
+        if (*reinterpret_cast<const quintptr *>(p) & mask)
+            return false;
+    for ( ; p < end; ++p)
+        if (quint8(*p) & 0x80)
+            return false;
+    return true;
+}
+
 // Decode a potentially large file in chunks and append it to target
 // using the append function passed on (fits QStringList and QString).
 
@@ -145,6 +164,29 @@ bool decodeTextFileContent(const QByteArray &dataBA,
     QTextCodec::ConverterState state;
     bool hasDecodingError = false;
 
+    const int mib = format.codec->mibEnum();
+    // The UTF-8 decoder reports errors reliably via ConverterState, so the
+    // expensive re-encode round trip of verifyDecodingError() can be skipped
+    // for it. This is by far the most common case.
+    const bool isUtf8 = mib == 106;
+
+    // Fast path for the typical source file: with an ASCII-compatible codec
+    // and pure 7-bit ASCII contents there is no codec state to track and no
+    // decoding error is possible, so the chunks convert directly.
+    if ((isUtf8 || mib == 4 /*Latin-1*/ || mib == 3 /*US-ASCII*/)
+            && isAscii(dataBA.constData(), dataBA.size())) {
+        const char *end = dataBA.constData() + dataBA.size();
+        for (const char *data = dataBA.constData(); data < end; ) {
+            const int chunkSize = qMin(int(textChunkSize), int(end - data));
+            QString text = QString::fromLatin1(data, chunkSize);
+            data += chunkSize;
+            if (format.lineTerminationMode == TextFileFormat::CRLFLineTerminator)
+                text.remove(QLatin1Char('\r'));
+            (target->*appendFunction)(text);
+        }
+        return true;
+    }
+
     const char *start = dataBA.constData();
     const char *data = start;
     const char *end  = data + dataBA.size();
@@ -163,10 +205,14 @@ bool decodeTextFileContent(const QByteArray &dataBA,
             text.append(format.codec->toUnicode(data, 1, &state));
         if (state.remainingChars)
             hasDecodingError = true;
-        if (!hasDecodingError)
-            hasDecodingError =
-                verifyDecodingError(text, format.codec, chunkStart, data - chunkStart,
-                                    chunkStart == start);
+        if (!hasDecodingError) {
+            if (isUtf8)
+                hasDecodingError = state.invalidChars > 0;
+            else
+                hasDecodingError =
+                    verifyDecodingError(text, format.codec, chunkStart, data - chunkStart,
+                                        chunkStart == start);
+        }
         if (format.lineTerminationMode == TextFileFormat::CRLFLineTerminator)
             text.remove(QLatin1Char('\r'));
         (target->*appendFunction)(text);
@@ -97,6 +97,11 @@ namespace {
     const QLatin1String PartitionSizeKey("PartitionSize");
     const QLatin1String ToolchainHostKey("ToolchainHost");
 
+    const QLatin1String SdkPlatformsLocationKey("SdkPlatformsLocation");
+    const QLatin1String SdkPlatformsTimestampKey("SdkPlatformsTimestamp");
+    const QLatin1String SdkSystemImagesTimestampKey("SdkSystemImagesTimestamp");
+    const QLatin1String SdkPlatformsSnapshotKey("SdkPlatformsSnapshot");
+
     const QLatin1String ArmToolchainPrefix("arm-linux-androideabi");
     const QLatin1String X86ToolchainPrefix("x86");
     const QLatin1String MipsToolchainPrefix("mipsel-linux-android");
@@ -243,6 +248,60 @@ QLatin1String AndroidConfig::displayName(const Abi &abi)
     }
 }
 
+static qint64 directoryTimestamp(const QString &path)
+{
+    const QFileInfo fi(path);
+    return fi.exists() ? fi.lastModified().toMSecsSinceEpoch() : 0;
+}
+
+static QVariantMap systemImageToMap(const SystemImage &image)
+{
+    QVariantMap map;
+    map.insert(QLatin1String("ApiLevel"), image.apiLevel);
+    map.insert(QLatin1String("AbiName"), image.abiName);
+    map.insert(QLatin1String("Package"), image.package);
+    map.insert(QLatin1String("InstalledLocation"), image.installedLocation.toString());
+    return map;
+}
+
+static SystemImage systemImageFromMap(const QVariantMap &map)
+{
+    SystemImage image;
+    image.apiLevel = map.value(QLatin1String("ApiLevel"), -1).toInt();
+    image.abiName = map.value(QLatin1String("AbiName")).toString();
+    image.package = map.value(QLatin1String("Package")).toString();
+    image.installedLocation
+            = FileName::fromString(map.value(QLatin1String("InstalledLocation")).toString());
+    return image;
+}
+
+static QVariantMap sdkPlatformToMap(const SdkPlatform &platform)
+{
+    QVariantMap map;
+    map.insert(QLatin1String("ApiLevel"), platform.apiLevel);
+    map.insert(QLatin1String("Name"), platform.name);
+    map.insert(QLatin1String("Package"), platform.package);
+    map.insert(QLatin1String("InstalledLocation"), platform.installedLocation.toString());
+    QVariantList images;
+    foreach (const SystemImage &image, platform.systemImages)
+        images << systemImageToMap(image);
+    map.insert(QLatin1String("SystemImages"), images);
+    return map;
+}
+
+static SdkPlatform sdkPlatformFromMap(const QVariantMap &map)
+{
+    SdkPlatform platform;
+    platform.apiLevel = map.value(QLatin1String("ApiLevel"), -1).toInt();
+    platform.name = map.value(QLatin1String("Name")).toString();
+    platform.package = map.value(QLatin1String("Package")).toString();
+    platform.installedLocation
+            = FileName::fromString(map.value(QLatin1String("InstalledLocation")).toString());
+    foreach (const QVariant &image, map.value(QLatin1String("SystemImages")).toList())
+        platform.systemImages << systemImageFromMap(image.toMap());
+    return platform;
+}
+
 void AndroidConfig::load(const QSettings &settings)
 {
     // user settings
@@ -279,6 +338,25 @@ void AndroidConfig::load(const QSettings &settings)
     }
     m_availableSdkPlatformsUpToDate = false;
     m_NdkInformationUpToDate = false;
+
+    // Restore the cached SDK platform listing if the SDK contents are
+    // unchanged. This avoids shelling out to the (slow) sdkmanager or android
+    // tool when the settings dialog or the kit update merely read the list.
+    m_availableSdkPlatforms.clear();
+    const qint64 platformsStamp
+            = directoryTimestamp(m_sdkLocation.toString() + QLatin1String("/platforms"));
+    if (platformsStamp != 0
+            && settings.value(SdkPlatformsLocationKey).toString() == m_sdkLocation.toString()
+            && settings.value(SdkPlatformsTimestampKey).toLongLong() == platformsStamp
+            && settings.value(SdkSystemImagesTimestampKey).toLongLong()
+               == directoryTimestamp(m_sdkLocation.toString() + QLatin1String("/system-images"))) {
+        foreach (const QVariant &entry, settings.value(SdkPlatformsSnapshotKey).toList()) {
+            const SdkPlatform platform = sdkPlatformFromMap(entry.toMap());
+            if (platform.isValid())
+                m_availableSdkPlatforms << platform;
+        }
+        m_availableSdkPlatformsUpToDate = !m_availableSdkPlatforms.isEmpty();
+    }
 }
 
 void AndroidConfig::save(QSettings &settings) const
@@ -300,6 +378,19 @@ void AndroidConfig::save(QSettings &settings) const
     settings.setValue(MakeExtraSearchDirectory,
                       m_makeExtraSearchDirectories.isEmpty() ? QString()
                                                              : m_makeExtraSearchDirectories.at(0));
+
+    // SDK platform snapshot, see AndroidConfig::load()
+    if (m_availableSdkPlatformsUpToDate) {
+        settings.setValue(SdkPlatformsLocationKey, m_sdkLocation.toString());
+        settings.setValue(SdkPlatformsTimestampKey,
+                          directoryTimestamp(m_sdkLocation.toString() + QLatin1String("/platforms")));
+        settings.setValue(SdkSystemImagesTimestampKey,
+                          directoryTimestamp(m_sdkLocation.toString() + QLatin1String("/system-images")));
+        QVariantList snapshot;
+        foreach (const SdkPlatform &platform, m_availableSdkPlatforms)
+            snapshot << sdkPlatformToMap(platform);
+        settings.setValue(SdkPlatformsSnapshotKey, snapshot);
+    }
 }
 
 void AndroidConfig::updateNdkInformation() const
@@ -142,7 +142,9 @@ bool GTestParser::processDocument(QFutureInterface<TestParseResultPtr> futureInt
     if (!m_cppSnapshot.contains(fileName) || !selectedForBuilding(fileName))
         return false;
     CPlusPlus::Document::Ptr document = m_cppSnapshot.find(fileName).value();
-    if (!includesGTest(document, m_cppSnapshot) || !hasGTestNames(document))
+    // scanning the document's own macro uses is much cheaper than walking the
+    // transitive include closure, so do it first to prune non-test files early
+    if (!hasGTestNames(document) || !includesGTest(document, m_cppSnapshot))
         return false;
     return handleGTest(futureInterface, document, m_cppSnapshot, id());
 }
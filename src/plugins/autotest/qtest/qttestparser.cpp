@@ -377,7 +377,9 @@ bool QtTestParser::processDocument(QFutureInterface<TestParseResultPtr> futureIn
     CPlusPlus::Document::Ptr doc = m_cppSnapshot.find(fileName).value();
     const QString &oldName = m_testCaseNames.value(fileName);
     const QStringList &alternativeFiles = m_alternativeFiles.values(fileName);
-    if ((!includesQtTest(doc, m_cppSnapshot) || !qtTestLibDefined(fileName)) && oldName.isEmpty())
+    // checking the project defines is much cheaper than walking the transitive
+    // include closure, so do it first to prune non-test files early
+    if ((!qtTestLibDefined(fileName) || !includesQtTest(doc, m_cppSnapshot)) && oldName.isEmpty())
         return false;
 
     return handleQtTest(futureInterface, doc, m_cppSnapshot, oldName, alternativeFiles, id());
@@ -214,9 +214,6 @@ bool QuickTestParser::handleQtQuickTest(QFutureInterface<TestParseResultPtr> fut
                                         const Core::Id &id) const
 {
     const CppTools::CppModelManager *modelManager = CppTools::CppModelManager::instance();
-    if (quickTestName(document).isEmpty())
-        return false;
-
     const QString cppFileName = document->fileName();
     QList<CppTools::ProjectPart::Ptr> ppList = modelManager->projectPart(cppFileName);
     if (ppList.isEmpty()) // happens if shutting down while parsing
@@ -329,7 +326,9 @@ bool QuickTestParser::processDocument(QFutureInterface<TestParseResultPtr> futur
     if (!m_cppSnapshot.contains(fileName) || !selectedForBuilding(fileName))
         return false;
     CPlusPlus::Document::Ptr document = m_cppSnapshot.find(fileName).value();
-    if (!includesQtQuickTest(document, m_cppSnapshot))
+    // scanning the document's own macro uses is much cheaper than walking the
+    // transitive include closure, so do it first to prune non-test files early
+    if (quickTestName(document).isEmpty() || !includesQtQuickTest(document, m_cppSnapshot))
         return false;
     return handleQtQuickTest(futureInterface, document, id());
 }
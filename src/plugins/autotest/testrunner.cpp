@@ -119,6 +119,14 @@ static QString rcInfo(const TestConfiguration * const config)
     return info + " \"" + config->runConfigDisplayName() + '"';
 }
 
+struct RunningTest
+{
+    QProcess *process = nullptr;
+    TestOutputReader *outputReader = nullptr;
+    const TestConfiguration *configuration = nullptr;
+    QTime executionTimer;
+};
+
 static void performTestRun(QFutureInterface<TestResultPtr> &futureInterface,
                            const QList<TestConfiguration *> selectedTests,
                            const TestSettings &settings)
@@ -147,79 +155,96 @@ static void performTestRun(QFutureInterface<TestResultPtr> &futureInterface,
         }
     }
 
-    QProcess testProcess;
-    testProcess.setReadChannel(QProcess::StandardOutput);
-
     futureInterface.setProgressRange(0, testCaseCount);
     futureInterface.setProgressValue(0);
 
-    for (const TestConfiguration *testConfiguration : selectedTests) {
-        QScopedPointer<TestOutputReader> outputReader;
-        outputReader.reset(testConfiguration->outputReader(futureInterface, &testProcess));
-        QTC_ASSERT(outputReader, continue);
-        TestRunner::connect(outputReader.data(), &TestOutputReader::newOutputAvailable,
-                            TestResultsPane::instance(), &TestResultsPane::addOutput);
-        if (futureInterface.isCanceled())
-            break;
-
-        if (!testConfiguration->project())
-            continue;
+    // All processes report into the same future interface, so their results
+    // show up merged in the result pane as they arrive.
+    const int maxProcesses = qMax(1, settings.concurrentProcesses);
+    QList<RunningTest> runningTests;
+    int nextIndex = 0;
+
+    while (nextIndex < selectedTests.size() || !runningTests.isEmpty()) {
+        // start further test processes until the configured limit is reached
+        while (runningTests.size() < maxProcesses && nextIndex < selectedTests.size()
+               && !futureInterface.isCanceled()) {
+            const TestConfiguration *testConfiguration = selectedTests.at(nextIndex++);
+            if (!testConfiguration->project())
+                continue;
+
+            const QString commandFilePath = testConfiguration->executableFilePath();
+            if (commandFilePath.isEmpty()) {
+                futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
+                    TestRunner::tr("Executable path is empty. (%1)")
+                                                       .arg(testConfiguration->displayName()))));
+                continue;
+            }
 
-        QProcessEnvironment environment = testConfiguration->environment().toProcessEnvironment();
-        QString commandFilePath = testConfiguration->executableFilePath();
-        if (commandFilePath.isEmpty()) {
-            futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
-                TestRunner::tr("Executable path is empty. (%1)")
-                                                   .arg(testConfiguration->displayName()))));
-            continue;
+            RunningTest running;
+            running.configuration = testConfiguration;
+            running.process = new QProcess;
+            running.process->setReadChannel(QProcess::StandardOutput);
+            running.outputReader = testConfiguration->outputReader(futureInterface, running.process);
+            QTC_ASSERT(running.outputReader, delete running.process; continue);
+            TestRunner::connect(running.outputReader, &TestOutputReader::newOutputAvailable,
+                                TestResultsPane::instance(), &TestResultsPane::addOutput);
+
+            QProcessEnvironment environment = testConfiguration->environment().toProcessEnvironment();
+            if (Utils::HostOsInfo::isWindowsHost())
+                environment.insert("QT_LOGGING_TO_CONSOLE", "1");
+            running.process->setArguments(testConfiguration->argumentsForTestRunner());
+            running.process->setWorkingDirectory(testConfiguration->workingDirectory());
+            running.process->setProcessEnvironment(environment);
+            running.process->setProgram(commandFilePath);
+            running.process->start();
+
+            if (!running.process->waitForStarted()) {
+                futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
+                    TestRunner::tr("Failed to start test for project \"%1\".")
+                        .arg(testConfiguration->displayName()) + processInformation(*running.process)
+                                                               + rcInfo(testConfiguration))));
+                delete running.outputReader;
+                delete running.process;
+                continue;
+            }
+            running.executionTimer.start();
+            runningTests.append(running);
         }
 
-        testProcess.setArguments(testConfiguration->argumentsForTestRunner());
-        testProcess.setWorkingDirectory(testConfiguration->workingDirectory());
-        if (Utils::HostOsInfo::isWindowsHost())
-            environment.insert("QT_LOGGING_TO_CONSOLE", "1");
-        testProcess.setProcessEnvironment(environment);
-        testProcess.setProgram(commandFilePath);
-        testProcess.start();
-
-        bool ok = testProcess.waitForStarted();
-        QTime executionTimer;
-        executionTimer.start();
-        bool canceledByTimeout = false;
-        if (ok) {
-            while (testProcess.state() == QProcess::Running) {
-                if (executionTimer.elapsed() >= timeout) {
-                    canceledByTimeout = true;
-                    break;
-                }
-                if (futureInterface.isCanceled()) {
-                    testProcess.kill();
-                    testProcess.waitForFinished();
-                    return;
-                }
-                eventLoop.processEvents();
+        if (runningTests.isEmpty())
+            break;
+
+        eventLoop.processEvents();
+
+        if (futureInterface.isCanceled()) {
+            for (const RunningTest &running : runningTests) {
+                running.process->kill();
+                running.process->waitForFinished();
+                delete running.outputReader;
+                delete running.process;
             }
-        } else {
-            futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
-                TestRunner::tr("Failed to start test for project \"%1\".")
-                    .arg(testConfiguration->displayName()) + processInformation(testProcess)
-                                                           + rcInfo(testConfiguration))));
-        }
-        if (testProcess.exitStatus() == QProcess::CrashExit) {
-            futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
-                TestRunner::tr("Test for project \"%1\" crashed.")
-                    .arg(testConfiguration->displayName()) + processInformation(testProcess)
-                                                           + rcInfo(testConfiguration))));
+            return;
         }
 
-        if (canceledByTimeout) {
-            if (testProcess.state() != QProcess::NotRunning) {
-                testProcess.kill();
-                testProcess.waitForFinished();
+        for (int i = runningTests.size() - 1; i >= 0; --i) {
+            RunningTest &running = runningTests[i];
+            if (running.process->state() == QProcess::Running) {
+                if (running.executionTimer.elapsed() < timeout)
+                    continue;
+                running.process->kill();
+                running.process->waitForFinished();
+                futureInterface.reportResult(TestResultPtr(
+                        new FaultyTestResult(Result::MessageFatal, TestRunner::tr(
+                        "Test case canceled due to timeout.\nMaybe raise the timeout?"))));
+            } else if (running.process->exitStatus() == QProcess::CrashExit) {
+                futureInterface.reportResult(TestResultPtr(new FaultyTestResult(Result::MessageFatal,
+                    TestRunner::tr("Test for project \"%1\" crashed.")
+                        .arg(running.configuration->displayName())
+                        + processInformation(*running.process) + rcInfo(running.configuration))));
             }
-            futureInterface.reportResult(TestResultPtr(
-                    new FaultyTestResult(Result::MessageFatal, TestRunner::tr(
-                    "Test case canceled due to timeout.\nMaybe raise the timeout?"))));
+            delete running.outputReader;
+            delete running.process;
+            runningTests.removeAt(i);
         }
     }
     futureInterface.setProgressValue(testCaseCount);
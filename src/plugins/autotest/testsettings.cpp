@@ -35,6 +35,7 @@ namespace Autotest {
 namespace Internal {
 
 static const char timeoutKey[]              = "Timeout";
+static const char concurrentProcessesKey[]  = "ConcurrentProcesses";
 static const char omitInternalKey[]         = "OmitInternal";
 static const char omitRunConfigWarnKey[]    = "OmitRCWarnings";
 static const char limitResultOutputKey[]    = "LimitResultOutput";
@@ -43,6 +44,7 @@ static const char filterScanKey[]           = "FilterScan";
 static const char filtersKey[]              = "WhiteListFilters";
 
 static const int defaultTimeout = 60000;
+static const int maxConcurrentProcesses = 16;
 
 TestSettings::TestSettings()
     : timeout(defaultTimeout)
@@ -53,6 +55,7 @@ void TestSettings::toSettings(QSettings *s) const
 {
     s->beginGroup(Constants::SETTINGSGROUP);
     s->setValue(timeoutKey, timeout);
+    s->setValue(concurrentProcessesKey, concurrentProcesses);
     s->setValue(omitInternalKey, omitInternalMssg);
     s->setValue(omitRunConfigWarnKey, omitRunConfigWarn);
     s->setValue(limitResultOutputKey, limitResultOutput);
@@ -69,6 +72,8 @@ void TestSettings::fromSettings(QSettings *s)
 {
     s->beginGroup(Constants::SETTINGSGROUP);
     timeout = s->value(timeoutKey, defaultTimeout).toInt();
+    concurrentProcesses = qBound(1, s->value(concurrentProcessesKey, 1).toInt(),
+                                 maxConcurrentProcesses);
     omitInternalMssg = s->value(omitInternalKey, true).toBool();
     omitRunConfigWarn = s->value(omitRunConfigWarnKey, false).toBool();
     limitResultOutput = s->value(limitResultOutputKey, true).toBool();
@@ -43,6 +43,7 @@ struct TestSettings
     void fromSettings(QSettings *s);
 
     int timeout;
+    int concurrentProcesses = 1;
     bool omitInternalMssg = true;
     bool omitRunConfigWarn = false;
     bool limitResultOutput = true;
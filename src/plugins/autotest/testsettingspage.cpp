@@ -144,6 +144,7 @@ TestSettingsWidget::TestSettingsWidget(QWidget *parent)
 void TestSettingsWidget::setSettings(const TestSettings &settings)
 {
     m_ui.timeoutSpin->setValue(settings.timeout / 1000); // we store milliseconds
+    m_ui.concurrentProcessesSpin->setValue(settings.concurrentProcesses);
     m_ui.omitInternalMsgCB->setChecked(settings.omitInternalMssg);
     m_ui.omitRunConfigWarnCB->setChecked(settings.omitRunConfigWarn);
     m_ui.limitResultOutputCB->setChecked(settings.limitResultOutput);
@@ -157,6 +158,7 @@ TestSettings TestSettingsWidget::settings() const
 {
     TestSettings result;
     result.timeout = m_ui.timeoutSpin->value() * 1000; // we display seconds
+    result.concurrentProcesses = m_ui.concurrentProcessesSpin->value();
     result.omitInternalMssg = m_ui.omitInternalMsgCB->isChecked();
     result.omitRunConfigWarn = m_ui.omitRunConfigWarnCB->isChecked();
     result.limitResultOutput = m_ui.limitResultOutputCB->isChecked();
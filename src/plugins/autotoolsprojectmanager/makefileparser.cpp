@@ -34,6 +34,9 @@
 #include <QDir>
 #include <QFileInfoList>
 #include <QMutexLocker>
+#include <QtConcurrentMap>
+
+#include <functional>
 
 using namespace AutotoolsProjectManager::Internal;
 
@@ -260,43 +263,62 @@ void MakefileParser::parseSubDirs()
     }
     subDirs.removeDuplicates();
 
-    // Delegate the parsing of all sub directories to a local
-    // makefile parser and merge the results
-    foreach (const QString& subDir, subDirs) {
-        const QChar slash = QLatin1Char('/');
-        const QString subDirMakefile = path + slash + subDir
-                                       + slash + makefileName;
-
-        // Parse sub directory
-        QFile file(subDirMakefile);
-
-        // Don't try to parse a file, that might not exist (e. g.
-        // if SUBDIRS specifies a 'po' directory).
-        if (!file.exists())
-            continue;
+    const QChar slash = QLatin1Char('/');
 
-        MakefileParser parser(subDirMakefile);
-        connect(&parser, &MakefileParser::status, this, &MakefileParser::status);
-        const bool success = parser.parse();
+    // Don't try to parse files that might not exist (e. g.
+    // if SUBDIRS specifies a 'po' directory).
+    QStringList existingSubDirs;
+    foreach (const QString &subDir, subDirs) {
+        if (QFile::exists(path + slash + subDir + slash + makefileName))
+            existingSubDirs.append(subDir);
+    }
 
-        // Don't return, try to parse as many sub directories
+    if (!existingSubDirs.isEmpty())
+        emit status(tr("Parsing %1 sub directories of %2").arg(existingSubDirs.size()).arg(path));
+
+    // Delegate the parsing of all sub directories to local makefile parsers
+    // and merge the results. The sub directories are independent of each
+    // other, and the recursion repeats this for the nested SUBDIRS, so the
+    // whole tree is parsed concurrently.
+    struct SubDirResult
+    {
+        QString subDir;
+        bool success;
+        QStringList sources;
+    };
+
+    const std::function<SubDirResult(const QString &)> parseSubDir
+            = [path, makefileName, slash](const QString &subDir) -> SubDirResult {
+        MakefileParser parser(path + slash + subDir + slash + makefileName);
+        SubDirResult result;
+        result.subDir = subDir;
+        result.success = parser.parse();
+        result.sources = parser.sources();
+        return result;
+    };
+    const QList<SubDirResult> results
+            = QtConcurrent::blockingMapped<QList<SubDirResult> >(existingSubDirs, parseSubDir);
+
+    foreach (const SubDirResult &result, results) {
+        // Don't give up, try to parse as many sub directories
         // as possible
-        if (!success)
+        if (!result.success)
             m_success = false;
 
-        m_makefiles.append(subDir + slash + makefileName);
+        m_makefiles.append(result.subDir + slash + makefileName);
 
         // Append the sources of the sub directory to the
         // current sources
-        foreach (const QString& source, parser.sources())
-            m_sources.append(subDir + slash + source);
-
-        // Duplicates might be possible in combination with several
-        // "..._SUBDIRS" targets
-        m_makefiles.removeDuplicates();
-        m_sources.removeDuplicates();
+        foreach (const QString &source, result.sources)
+            m_sources.append(result.subDir + slash + source);
     }
 
+    // Duplicates might be possible in combination with several
+    // "..._SUBDIRS" targets. Cleaning up once after the loop keeps the
+    // merge linear; doing it per sub directory made large trees quadratic.
+    m_makefiles.removeDuplicates();
+    m_sources.removeDuplicates();
+
     if (subDirs.isEmpty())
         m_success = false;
 }
@@ -58,6 +58,20 @@ public:
      */
     virtual Command command() const = 0;
 
+    /**
+     * Returns the tool's command to format only the range of @a length characters starting
+     * at @a offset. Tools without support for formatting a range return the command for the
+     * entire file.
+     *
+     * @note    The received command may be invalid.
+     */
+    virtual Command command(int offset, int length) const
+    {
+        Q_UNUSED(offset)
+        Q_UNUSED(length)
+        return command();
+    }
+
     virtual bool isApplicable(const Core::IDocument *document) const = 0;
 };
 
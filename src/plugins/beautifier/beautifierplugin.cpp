@@ -172,6 +172,36 @@ QString sourceData(TextEditorWidget *editor, int startPos, int endPos)
             : Convenience::textAt(editor->textCursor(), startPos, (endPos - startPos));
 }
 
+/**
+ * Determines the range of characters that has been edited since the document was saved the
+ * last time, based on the revisions of the text blocks. Returns false if nothing was edited
+ * or the edits span the entire document.
+ */
+bool editedRangeSinceLastSave(QTextDocument *document, int *offset, int *length)
+{
+    const auto layout = qobject_cast<TextDocumentLayout *>(document->documentLayout());
+    if (!layout)
+        return false;
+
+    QTextBlock firstEdited;
+    QTextBlock lastEdited;
+    for (QTextBlock block = document->firstBlock(); block.isValid(); block = block.next()) {
+        if (block.revision() > layout->lastSaveRevision) {
+            if (!firstEdited.isValid())
+                firstEdited = block;
+            lastEdited = block;
+        }
+    }
+    if (!firstEdited.isValid())
+        return false;
+    if (firstEdited == document->firstBlock() && lastEdited == document->lastBlock())
+        return false;
+
+    *offset = firstEdited.position();
+    *length = lastEdited.position() + lastEdited.length() - firstEdited.position();
+    return true;
+}
+
 bool isAutoFormatApplicable(const Core::IDocument *document,
                             const QList<Utils::MimeType> &allowedMimeTypes)
 {
@@ -266,8 +296,17 @@ void BeautifierPlugin::autoFormatOnSave(Core::IDocument *document)
         const QList<Core::IEditor *> editors = Core::DocumentModel::editorsForDocument(document);
         if (editors.isEmpty())
             return;
-        if (TextEditorWidget* widget = qobject_cast<TextEditorWidget *>(editors.first()->widget()))
-            formatEditor(widget, command);
+        if (TextEditorWidget* widget = qobject_cast<TextEditorWidget *>(editors.first()->widget())) {
+            // Restrict the formatting to the lines edited since the last save if the tool
+            // supports formatting a range; command(int, int) falls back to the whole file
+            // for tools that do not.
+            int offset = -1;
+            int length = -1;
+            if (editedRangeSinceLastSave(widget->document(), &offset, &length))
+                formatEditor(widget, (*tool)->command(offset, length));
+            else
+                formatEditor(widget, command);
+        }
     }
 }
 
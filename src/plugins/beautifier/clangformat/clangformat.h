@@ -50,6 +50,7 @@ public:
     void updateActions(Core::IEditor *editor) override;
     QList<QObject *> autoReleaseObjects() override;
     Command command() const override;
+    Command command(int offset, int length) const override;
     bool isApplicable(const Core::IDocument *document) const override;
 
 private:
@@ -59,7 +60,6 @@ private:
     QAction *m_formatFile = nullptr;
     QAction *m_formatRange = nullptr;
     ClangFormatSettings *m_settings;
-    Command command(int offset, int length) const;
 };
 
 } // namespace ClangFormat
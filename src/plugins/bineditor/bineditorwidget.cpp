@@ -59,6 +59,8 @@
 #include <QToolTip>
 #include <QWheelEvent>
 
+#include <climits>
+
 using namespace Core;
 
 static QByteArray calculateHexPattern(const QByteArray &pattern)
@@ -234,7 +236,13 @@ void BinEditorWidget::addData(quint64 addr, const QByteArray &data)
         const qint64 translatedBlock = (addr - m_baseAddr) / m_blockSize;
         m_data.insert(translatedBlock, data);
         m_requests.remove(translatedBlock);
-        viewport()->update();
+        // Blocks stream in one by one; repaint just the lines the block
+        // covers instead of the whole viewport.
+        const qint64 pos = translatedBlock * m_blockSize;
+        if (pos + m_blockSize <= qint64(INT_MAX))
+            updateLines(int(pos), int(pos + m_blockSize - 1));
+        else
+            viewport()->update();
     }
 }
 
@@ -301,11 +301,7 @@ void BookmarkView::removeAll()
             QLatin1String("RemoveAllBookmarks")) != QDialogButtonBox::Yes)
         return;
 
-    // The performance of this function could be greatly improved.
-    while (m_manager->rowCount()) {
-        QModelIndex index = m_manager->index(0, 0);
-        removeBookmark(index);
-    }
+    m_manager->removeAllBookmarks();
 }
 
 void BookmarkView::gotoBookmark(const QModelIndex &index)
@@ -328,6 +324,13 @@ BookmarkManager::BookmarkManager() :
     connect(SessionManager::instance(), &SessionManager::sessionLoaded,
             this, &BookmarkManager::loadBookmarks);
 
+    // coalesce bursts of changes into a single save
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(500);
+    connect(&m_saveTimer, &QTimer::timeout, this, &BookmarkManager::saveBookmarks);
+    connect(SessionManager::instance(), &SessionManager::aboutToSaveSession,
+            this, &BookmarkManager::saveBookmarks);
+
     updateActionStatus();
 }
 
@@ -455,7 +458,7 @@ void BookmarkManager::updateBookmark(Bookmark *bookmark)
         return;
 
     emit dataChanged(index(idx, 0, QModelIndex()), index(idx, 2, QModelIndex()));
-    saveBookmarks();
+    scheduleSaveBookmarks();
 }
 
 void BookmarkManager::updateBookmarkFileName(Bookmark *bookmark, const QString &oldFileName)
@@ -490,6 +493,9 @@ void BookmarkManager::removeAllBookmarks()
     m_bookmarksMap.clear();
     m_bookmarksList.clear();
     endRemoveRows();
+
+    updateActionStatus();
+    scheduleSaveBookmarks();
 }
 
 bool BookmarkManager::removeBookmarkFromMap(Bookmark *bookmark, const QString &fileName)
@@ -529,7 +535,7 @@ void BookmarkManager::deleteBookmark(Bookmark *bookmark)
         selectionModel()->setCurrentIndex(selectionModel()->currentIndex(), QItemSelectionModel::Select | QItemSelectionModel::Clear);
 
     updateActionStatus();
-    saveBookmarks();
+    scheduleSaveBookmarks();
 }
 
 Bookmark *BookmarkManager::bookmarkForIndex(const QModelIndex &index) const
@@ -690,7 +696,7 @@ void BookmarkManager::moveUp()
     emit dataChanged(topLeft, bottomRight);
     selectionModel()->setCurrentIndex(current.sibling(row, 0), QItemSelectionModel::Select | QItemSelectionModel::Clear);
 
-    saveBookmarks();
+    scheduleSaveBookmarks();
 }
 
 void BookmarkManager::moveDown()
@@ -711,7 +717,7 @@ void BookmarkManager::moveDown()
     emit dataChanged(topLeft, bottomRight);
     selectionModel()->setCurrentIndex(current.sibling(row, 0), QItemSelectionModel::Select | QItemSelectionModel::Clear);
 
-    saveBookmarks();
+    scheduleSaveBookmarks();
 }
 
 void BookmarkManager::editByFileAndLine(const QString &fileName, int lineNumber)
@@ -748,7 +754,7 @@ void BookmarkManager::edit()
         b->move(lineNumberSpinbox->value());
         b->updateNote(noteEdit->text().replace(QLatin1Char('\t'), QLatin1Char(' ')));
         emit dataChanged(current, current);
-        saveBookmarks();
+        scheduleSaveBookmarks();
     }
 }
 
@@ -790,7 +796,7 @@ void BookmarkManager::addBookmark(Bookmark *bookmark, bool userset)
     endInsertRows();
     if (userset) {
         updateActionStatus();
-        saveBookmarks();
+        scheduleSaveBookmarks();
     }
     selectionModel()->setCurrentIndex(index(m_bookmarksList.size()-1 , 0, QModelIndex()), QItemSelectionModel::Select | QItemSelectionModel::Clear);
 }
@@ -831,9 +837,20 @@ QString BookmarkManager::bookmarkToString(const Bookmark *b)
             noteDelimiter + b->note();
 }
 
+/* Schedules a deferred save, so that a burst of changes (e.g. removing many
+ * bookmarks at once) serializes the list only once instead of per change.
+ * The save timer is flushed via aboutToSaveSession before the session
+ * settings are written out. */
+void BookmarkManager::scheduleSaveBookmarks()
+{
+    m_saveTimer.start();
+}
+
 /* Saves the bookmarks to the session settings. */
 void BookmarkManager::saveBookmarks()
 {
+    m_saveTimer.stop();
+
     QStringList list;
     foreach (const Bookmark *bookmark, m_bookmarksList)
         list << bookmarkToString(bookmark);
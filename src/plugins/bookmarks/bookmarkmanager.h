@@ -34,6 +34,7 @@
 #include <QListView>
 #include <QPixmap>
 #include <QStyledItemDelegate>
+#include <QTimer>
 
 namespace Core { class IContext; }
 
@@ -113,6 +114,7 @@ private:
     void addBookmarkToMap(Bookmark *bookmark);
     bool removeBookmarkFromMap(Bookmark *bookmark, const QString &fileName = QString());
     static QString bookmarkToString(const Bookmark *b);
+    void scheduleSaveBookmarks();
     void saveBookmarks();
 
     typedef QMultiMap<QString, Bookmark *> FileNameBookmarksMap;
@@ -122,6 +124,7 @@ private:
 
     QList<Bookmark *> m_bookmarksList;
     QItemSelectionModel *m_selectionModel;
+    QTimer m_saveTimer;
 };
 
 class BookmarkView : public Utils::ListView
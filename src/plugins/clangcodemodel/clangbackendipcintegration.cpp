@@ -552,9 +552,15 @@ void IpcCommunicator::registerCurrentProjectParts()
 {
     using namespace CppTools;
 
+    // Send the project parts of all projects in one message. After a backend
+    // restart this brings the backend back to a usable state with a single
+    // snapshot instead of one message per project.
+    QVector<ProjectPart::Ptr> projectParts;
     const QList<ProjectInfo> projectInfos = CppModelManager::instance()->projectInfos();
     foreach (const ProjectInfo &projectInfo, projectInfos)
-        registerProjectsParts(projectInfo.projectParts());
+        projectParts << projectInfo.projectParts();
+
+    registerProjectsParts(projectParts);
 }
 
 void IpcCommunicator::restoreCppEditorDocuments()
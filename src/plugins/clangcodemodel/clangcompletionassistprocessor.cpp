@@ -107,6 +107,28 @@ QList<AssistProposalItemInterface *> toAssistProposalItems(const CodeCompletions
     return results;
 }
 
+// The results of the last completion request answered by the backend. The
+// request position is the start of the completed token, so typing further
+// characters of the same identifier triggers a request for the very same
+// position again, and the backend would recompute an identical result with
+// a libclang code completion that easily takes several hundred milliseconds.
+// SendDocumentTracker tells us whether anything was edited at or before the
+// position in the meantime, so such a repeated request can be answered from
+// this cache and refined client-side by the proposal filtering.
+struct LastCompletionResults
+{
+    QString filePath;
+    int position = -1;
+    CodeCompletions completions;
+    CompletionCorrection neededCorrection = CompletionCorrection::NoCorrection;
+};
+
+LastCompletionResults &lastCompletionResults()
+{
+    static LastCompletionResults results;
+    return results;
+}
+
 } // Anonymous
 
 using namespace CPlusPlus;
@@ -147,6 +169,14 @@ void ClangCompletionAssistProcessor::handleAvailableCompletions(
 {
     QTC_CHECK(m_completions.isEmpty());
 
+    if (m_sentRequestPosition != -1) {
+        LastCompletionResults &cache = lastCompletionResults();
+        cache.filePath = m_interface->fileName();
+        cache.position = m_sentRequestPosition;
+        cache.completions = completions;
+        cache.neededCorrection = neededCorrection;
+    }
+
     if (m_sentRequestType == NormalCompletion) {
         m_completions = toAssistProposalItems(completions);
 
@@ -245,6 +275,10 @@ IAssistProposal *ClangCompletionAssistProcessor::startCompletionHelper()
     case ClangCompletionContextAnalyzer::PassThroughToLibClang: {
         m_addSnippets = m_completionOperator == T_EOF_SYMBOL;
         m_sentRequestType = NormalCompletion;
+        if (modifiedFileContent.isEmpty()) {
+            if (IAssistProposal *proposal = proposalFromCache(analyzer.positionForClang()))
+                return proposal;
+        }
         const bool requestSent = sendCompletionRequest(analyzer.positionForClang(),
                                                        modifiedFileContent);
         setPerformWasApplicable(requestSent);
@@ -252,6 +286,8 @@ IAssistProposal *ClangCompletionAssistProcessor::startCompletionHelper()
     }
     case ClangCompletionContextAnalyzer::PassThroughToLibClangAfterLeftParen: {
         m_sentRequestType = FunctionHintCompletion;
+        if (IAssistProposal *proposal = proposalFromCache(analyzer.positionForClang()))
+            return proposal;
         const bool requestSent = sendCompletionRequest(analyzer.positionForClang(), QByteArray());
         setPerformWasApplicable(requestSent);
         break;
@@ -547,6 +583,32 @@ void setLastCompletionPosition(const QString &filePath,
 
 }
 
+TextEditor::IAssistProposal *ClangCompletionAssistProcessor::proposalFromCache(int position)
+{
+    const LastCompletionResults &cache = lastCompletionResults();
+    const QString filePath = m_interface->fileName();
+
+    if (cache.position != position || cache.filePath != filePath)
+        return 0;
+
+    // The tracker forgets the position as soon as something is edited at or
+    // before it, so a match means the cached results are still up to date.
+    if (shouldSendCodeCompletion(filePath, position))
+        return 0;
+
+    if (m_sentRequestType == NormalCompletion) {
+        m_completions = toAssistProposalItems(cache.completions);
+        if (m_addSnippets && !m_completions.isEmpty())
+            addSnippets();
+        return createProposal(cache.neededCorrection);
+    }
+
+    const CodeCompletions functionSignatures = filterFunctionSignatures(cache.completions);
+    if (functionSignatures.isEmpty())
+        return 0;
+    return createFunctionHintProposal(functionSignatures);
+}
+
 bool ClangCompletionAssistProcessor::sendCompletionRequest(int position,
                                                            const QByteArray &customFileContent)
 {
@@ -569,6 +631,9 @@ bool ClangCompletionAssistProcessor::sendCompletionRequest(int position,
         const QString projectPartId = CppTools::CppToolsBridge::projectPartIdForFile(filePath);
         ipcCommunicator.completeCode(this, filePath, uint(line), uint(column), projectPartId);
         setLastCompletionPosition(filePath, position);
+        // Results for custom modified content must not be served again for
+        // a request against the real document content.
+        m_sentRequestPosition = customFileContent.isEmpty() ? position : -1;
         return true;
     }
 
@@ -65,6 +65,7 @@ private:
             CompletionCorrection neededCorrection = CompletionCorrection::NoCorrection) const;
     TextEditor::IAssistProposal *createFunctionHintProposal(
             const CodeCompletions &completions) const;
+    TextEditor::IAssistProposal *proposalFromCache(int position);
 
     bool completeInclude(const QTextCursor &cursor);
     bool completeInclude(int position);
@@ -88,6 +89,7 @@ private:
     QScopedPointer<const ClangCompletionAssistInterface> m_interface;
     unsigned m_completionOperator;
     enum CompletionRequestType { NormalCompletion, FunctionHintCompletion } m_sentRequestType;
+    int m_sentRequestPosition = -1; // -1 means results must not be cached
     bool m_addSnippets = false; // For type == Type::NormalCompletion
 };
 
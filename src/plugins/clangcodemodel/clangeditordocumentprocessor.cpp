@@ -34,7 +34,9 @@
 #include "clangutils.h"
 
 #include <diagnosticcontainer.h>
+#include <highlightingmarkcontainer.h>
 #include <sourcelocationcontainer.h>
+#include <sourcerangecontainer.h>
 
 #include <cpptools/clangdiagnosticconfigsmodel.h>
 #include <cpptools/clangdiagnosticconfigsmodel.h>
@@ -46,6 +48,8 @@
 #include <cpptools/cppworkingcopy.h>
 #include <cpptools/editordocumenthandle.h>
 
+#include <coreplugin/idocument.h>
+
 #include <texteditor/convenience.h>
 #include <texteditor/displaysettings.h>
 #include <texteditor/fontsettings.h>
@@ -58,6 +62,8 @@
 #include <utils/qtcassert.h>
 #include <utils/runextensions.h>
 
+#include <QCryptographicHash>
+#include <QHash>
 #include <QTextBlock>
 #include <QVBoxLayout>
 #include <QWidget>
@@ -65,6 +71,34 @@
 namespace ClangCodeModel {
 namespace Internal {
 
+namespace {
+
+struct SavedAnnotations
+{
+    QByteArray contentsHash;
+    QVector<ClangBackEnd::DiagnosticContainer> diagnostics;
+    ClangBackEnd::DiagnosticContainer firstHeaderErrorDiagnostic;
+    QVector<ClangBackEnd::HighlightingMarkContainer> highlightingMarks;
+    QVector<ClangBackEnd::SourceRangeContainer> skippedPreprocessorRanges;
+};
+
+// The last annotations of closed documents, keyed by file path. Reopening a
+// document with unchanged contents replays them instantly while the fresh
+// parse proceeds in the background.
+QHash<QString, SavedAnnotations> &savedAnnotationsForFilePath()
+{
+    static QHash<QString, SavedAnnotations> savedAnnotations;
+    return savedAnnotations;
+}
+
+QByteArray contentsHash(QTextDocument *textDocument)
+{
+    return QCryptographicHash::hash(textDocument->toPlainText().toUtf8(),
+                                    QCryptographicHash::Sha1);
+}
+
+} // anonymous namespace
+
 ClangEditorDocumentProcessor::ClangEditorDocumentProcessor(
         IpcCommunicator &ipcCommunicator,
         TextEditor::TextDocument *document)
@@ -91,6 +125,11 @@ ClangEditorDocumentProcessor::ClangEditorDocumentProcessor(
             this, &ClangEditorDocumentProcessor::cppDocumentUpdated);
     connect(&m_builtinProcessor, &CppTools::BuiltinEditorDocumentProcessor::semanticInfoUpdated,
             this, &ClangEditorDocumentProcessor::semanticInfoUpdated);
+
+    // Reloading replaces the text document contents and with it the applied
+    // layout formats, so the next update must not be skipped as identical.
+    connect(&m_document, &Core::IDocument::reloadFinished,
+            this, [this](bool) { m_lastHighlightingMarks.clear(); });
 }
 
 ClangEditorDocumentProcessor::~ClangEditorDocumentProcessor()
@@ -100,6 +139,8 @@ ClangEditorDocumentProcessor::~ClangEditorDocumentProcessor()
     m_parserWatcher.cancel();
     m_parserWatcher.waitForFinished();
 
+    saveAnnotationsForReopen();
+
     if (m_projectPart) {
         m_ipcCommunicator.unregisterTranslationUnitsForEditor(
             {ClangBackEnd::FileContainer(filePath(), m_projectPart->id())});
@@ -109,6 +150,11 @@ ClangEditorDocumentProcessor::~ClangEditorDocumentProcessor()
 void ClangEditorDocumentProcessor::runImpl(
         const CppTools::BaseEditorDocumentParser::UpdateParams &updateParams)
 {
+    if (!m_hasReplayedSavedAnnotations) {
+        m_hasReplayedSavedAnnotations = true;
+        replaySavedAnnotations();
+    }
+
     m_updateTranslationUnitTimer.start();
 
     // Run clang parser
@@ -136,6 +182,9 @@ void ClangEditorDocumentProcessor::semanticRehighlight()
 {
     m_semanticHighlighter.updateFormatMapFromFontSettings();
 
+    // The formats changed, so identical marks must be applied again.
+    m_lastHighlightingMarks.clear();
+
     if (m_projectPart)
         requestDocumentAnnotations(m_projectPart->id());
 }
@@ -181,6 +230,9 @@ void ClangEditorDocumentProcessor::updateCodeWarnings(
         uint documentRevision)
 {
     if (documentRevision == revision()) {
+        m_lastDiagnostics = diagnostics;
+        m_lastFirstHeaderErrorDiagnostic = firstHeaderErrorDiagnostic;
+
         m_diagnosticManager.processNewDiagnostics(diagnostics, m_isProjectFile);
         const auto codeWarnings = m_diagnosticManager.takeExtraSelections();
         const auto fixitAvailableMarkers = m_diagnosticManager.takeFixItAvailableMarkers();
@@ -230,9 +282,20 @@ void ClangEditorDocumentProcessor::updateHighlighting(
         uint documentRevision)
 {
     if (documentRevision == revision()) {
+        m_lastSkippedPreprocessorRanges = skippedPreprocessorRanges;
+        m_lastAnnotationsRevision = documentRevision;
+
         const auto skippedPreprocessorBlocks = toTextEditorBlocks(textDocument(), skippedPreprocessorRanges);
         emit ifdefedOutBlocksUpdated(documentRevision, skippedPreprocessorBlocks);
 
+        // A reparse very often yields exactly the marks that are already
+        // applied, e.g. after saving or for edits without semantic effect.
+        // Skip the highlighting run in that case; it would convert and
+        // re-diff every mark just to change nothing.
+        if (highlightingMarks == m_lastHighlightingMarks)
+            return;
+        m_lastHighlightingMarks = highlightingMarks;
+
         m_semanticHighlighter.setHighlightingRunner(
             [highlightingMarks]() {
                 auto *reporter = new HighlightingMarksReporter(highlightingMarks);
@@ -377,6 +440,37 @@ void ClangEditorDocumentProcessor::updateProjectPartAndTranslationUnitForEditor(
     }
 }
 
+void ClangEditorDocumentProcessor::replaySavedAnnotations()
+{
+    const auto saved = savedAnnotationsForFilePath().constFind(filePath());
+    if (saved == savedAnnotationsForFilePath().constEnd())
+        return;
+
+    if (saved->contentsHash != contentsHash(textDocument()))
+        return;
+
+    updateCodeWarnings(saved->diagnostics, saved->firstHeaderErrorDiagnostic, revision());
+    updateHighlighting(saved->highlightingMarks, saved->skippedPreprocessorRanges, revision());
+}
+
+void ClangEditorDocumentProcessor::saveAnnotationsForReopen()
+{
+    // Save only annotations that match the current document contents. After
+    // a font settings change or a reload the highlighting cache is empty and
+    // replaying it would wrongly clear the formats on reopen.
+    if (m_lastAnnotationsRevision != revision() || m_lastHighlightingMarks.isEmpty())
+        return;
+
+    SavedAnnotations annotations;
+    annotations.contentsHash = contentsHash(textDocument());
+    annotations.diagnostics = m_lastDiagnostics;
+    annotations.firstHeaderErrorDiagnostic = m_lastFirstHeaderErrorDiagnostic;
+    annotations.highlightingMarks = m_lastHighlightingMarks;
+    annotations.skippedPreprocessorRanges = m_lastSkippedPreprocessorRanges;
+
+    savedAnnotationsForFilePath().insert(filePath(), annotations);
+}
+
 void ClangEditorDocumentProcessor::onParserFinished()
 {
     if (revision() != m_parserRevision)
@@ -37,6 +37,7 @@
 namespace ClangBackEnd {
 class DiagnosticContainer;
 class HighlightingMarkContainer;
+class SourceRangeContainer;
 class FileContainer;
 }
 
@@ -96,6 +97,8 @@ public:
 
 private:
     void onParserFinished();
+    void replaySavedAnnotations();
+    void saveAnnotationsForReopen();
     void updateProjectPartAndTranslationUnitForEditor();
     void registerTranslationUnitForEditor(CppTools::ProjectPart *projectPart);
     void updateTranslationUnitIfProjectPartExists();
@@ -118,6 +121,12 @@ private:
     QFutureWatcher<void> m_parserWatcher;
     QTimer m_updateTranslationUnitTimer;
     unsigned m_parserRevision;
+    QVector<ClangBackEnd::HighlightingMarkContainer> m_lastHighlightingMarks;
+    QVector<ClangBackEnd::DiagnosticContainer> m_lastDiagnostics;
+    ClangBackEnd::DiagnosticContainer m_lastFirstHeaderErrorDiagnostic;
+    QVector<ClangBackEnd::SourceRangeContainer> m_lastSkippedPreprocessorRanges;
+    uint m_lastAnnotationsRevision = 0;
+    bool m_hasReplayedSavedAnnotations = false;
 
     CppTools::SemanticHighlighter m_semanticHighlighter;
     CppTools::BuiltinEditorDocumentProcessor m_builtinProcessor;
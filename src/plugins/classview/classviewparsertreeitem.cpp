@@ -103,37 +103,6 @@ void ParserTreeItem::copy(const ParserTreeItem::ConstPtr &from)
     d->symbolInformations = from->d->symbolInformations;
 }
 
-/*!
-    \fn void copyTree(const ParserTreeItem::ConstPtr &from)
-    Copies a parser tree item with children from the location specified by
-    \a from to this item.
-*/
-
-void ParserTreeItem::copyTree(const ParserTreeItem::ConstPtr &target)
-{
-    if (target.isNull())
-        return;
-
-    // copy content
-    d->symbolLocations = target->d->symbolLocations;
-    d->icon = target->d->icon;
-    d->symbolInformations.clear();
-
-    // reserve memory
-//    int amount = qMin(100 , target->d_ptr->symbolInformations.count() * 2);
-//    d_ptr->symbolInformations.reserve(amount);
-
-    // every child
-    CitSymbolInformations cur = target->d->symbolInformations.constBegin();
-    CitSymbolInformations end = target->d->symbolInformations.constEnd();
-
-    for (; cur != end; ++cur) {
-        ParserTreeItem::Ptr item(new ParserTreeItem());
-        item->copyTree(cur.value());
-        appendChild(item, cur.key());
-    }
-}
-
 /*!
     Adds information about symbol location from a \location.
     \sa SymbolLocation, removeSymbolLocation, symbolLocations
@@ -253,10 +222,14 @@ void ParserTreeItem::add(const ParserTreeItem::ConstPtr &target)
         return;
 
     // add locations
-    d->symbolLocations = d->symbolLocations.unite(target->d->symbolLocations);
+    d->symbolLocations.unite(target->d->symbolLocations);
 
     // add children
-    // every target child
+    // the target trees are the cached per-document trees, which stay untouched
+    // while they are cached. Subtrees that exist only in the target can
+    // therefore be shared instead of deep copied. Only when both sides contain
+    // the same symbol a fresh node is created for the merged result, which
+    // leaves the shared subtrees of both sides untouched.
     CitSymbolInformations cur = target->d->symbolInformations.constBegin();
     CitSymbolInformations end = target->d->symbolInformations.constEnd();
     while (cur != end) {
@@ -264,12 +237,13 @@ void ParserTreeItem::add(const ParserTreeItem::ConstPtr &target)
         const ParserTreeItem::Ptr &targetChild = cur.value();
 
         ParserTreeItem::Ptr child = d->symbolInformations.value(inf);
-        if (!child.isNull()) {
-            child->add(targetChild);
+        if (child.isNull()) {
+            d->symbolInformations[inf] = targetChild;
         } else {
-            ParserTreeItem::Ptr add(new ParserTreeItem());
-            add->copyTree(targetChild);
-            d->symbolInformations[inf] = add;
+            ParserTreeItem::Ptr merged(new ParserTreeItem());
+            merged->copy(child);
+            merged->add(targetChild);
+            d->symbolInformations[inf] = merged;
         }
         // next item
         ++cur;
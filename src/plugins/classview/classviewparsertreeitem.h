@@ -48,8 +48,6 @@ public:
     ParserTreeItem();
     ~ParserTreeItem();
 
-    void copyTree(const ParserTreeItem::ConstPtr &from);
-
     void copy(const ParserTreeItem::ConstPtr &from);
 
     void addSymbolLocation(const SymbolLocation &location);
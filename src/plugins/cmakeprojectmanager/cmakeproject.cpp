@@ -132,6 +132,35 @@ CMakeProject::~CMakeProject()
     qDeleteAll(m_allFiles);
 }
 
+static bool sameProjectTree(const FolderNode *a, const FolderNode *b)
+{
+    if (a->filePath() != b->filePath() || a->displayName() != b->displayName()
+            || a->nodeType() != b->nodeType())
+        return false;
+
+    const QList<FileNode *> aFiles = a->fileNodes();
+    const QList<FileNode *> bFiles = b->fileNodes();
+    if (aFiles.size() != bFiles.size())
+        return false;
+    for (int i = 0; i < aFiles.size(); ++i) {
+        const FileNode *af = aFiles.at(i);
+        const FileNode *bf = bFiles.at(i);
+        if (af->filePath() != bf->filePath() || af->fileType() != bf->fileType()
+                || af->isGenerated() != bf->isGenerated())
+            return false;
+    }
+
+    const QList<FolderNode *> aFolders = a->folderNodes();
+    const QList<FolderNode *> bFolders = b->folderNodes();
+    if (aFolders.size() != bFolders.size())
+        return false;
+    for (int i = 0; i < aFolders.size(); ++i) {
+        if (!sameProjectTree(aFolders.at(i), bFolders.at(i)))
+            return false;
+    }
+    return true;
+}
+
 void CMakeProject::updateProjectData(CMakeBuildConfiguration *bc)
 {
     QTC_ASSERT(bc, return);
@@ -147,8 +176,16 @@ void CMakeProject::updateProjectData(CMakeBuildConfiguration *bc)
 
     auto newRoot = bc->generateProjectTree(m_allFiles);
     if (newRoot) {
-        setDisplayName(newRoot->displayName());
-        setRootProjectNode(newRoot);
+        // Re-running cmake without changes to the CMakeLists.txt files is
+        // common and produces an identical tree. Keep the existing nodes in
+        // that case instead of resetting the whole project model, which would
+        // throw away the expansion state and current item of the tree views.
+        if (rootProjectNode() && sameProjectTree(rootProjectNode(), newRoot)) {
+            delete newRoot;
+        } else {
+            setDisplayName(newRoot->displayName());
+            setRootProjectNode(newRoot);
+        }
     }
 
     updateApplicationAndDeploymentTargets();
@@ -477,11 +477,20 @@ void ActionManagerPrivate::saveSettings(Action *cmd)
 {
     const QString settingsKey = QLatin1String(kKeyboardSettingsKey) + QLatin1Char('/')
             + cmd->id().toString();
-    QKeySequence key = cmd->keySequence();
-    if (key != cmd->defaultKeySequence())
-        ICore::settings()->setValue(settingsKey, key.toString());
-    else
-        ICore::settings()->remove(settingsKey);
+    QSettings *settings = ICore::settings();
+    const QKeySequence key = cmd->keySequence();
+    // Only touch the settings if something changed: QSettings marks the file
+    // dirty on every setValue() and remove(), even of a non-existing key, and
+    // a dirty file is rewritten completely on the next sync. Since this runs
+    // for every registered command on each save settings cascade, that made
+    // every cascade rewrite the whole user settings file.
+    if (key != cmd->defaultKeySequence()) {
+        const QString keyString = key.toString();
+        if (settings->value(settingsKey).toString() != keyString)
+            settings->setValue(settingsKey, keyString);
+    } else if (settings->contains(settingsKey)) {
+        settings->remove(settingsKey);
+    }
 }
 
 void ActionManagerPrivate::saveSettings()
@@ -349,6 +349,7 @@ bool ShortcutSettingsWidget::validateShortcutEdit() const
 
     if (keySequenceIsValid(currentKey) || text.isEmpty()) {
         item->m_key = currentKey;
+        item->m_keyText = keySequenceToEditString(currentKey);
         auto that = const_cast<ShortcutSettingsWidget *>(this);
         if (item->m_cmd->defaultKeySequence() != item->m_key)
             that->setModified(current, true);
@@ -375,10 +376,10 @@ bool ShortcutSettingsWidget::filterColumn(const QString &filterString, QTreeWidg
         if (!item->data(0, Qt::UserRole).isValid())
             return true;
         ShortcutItem *scitem = qvariant_cast<ShortcutItem *>(item->data(0, Qt::UserRole));
-        text = keySequenceToEditString(scitem->m_key);
+        text = scitem->m_keyText;
     } else if (column == 0 && item->data(0, Qt::UserRole).isValid()) { // command id
         ShortcutItem *scitem = qvariant_cast<ShortcutItem *>(item->data(0, Qt::UserRole));
-        text = scitem->m_cmd->id().toString();
+        text = scitem->m_idText;
     } else {
         text = item->text(column);
     }
@@ -424,6 +425,7 @@ void ShortcutSettingsWidget::importAction()
             QString sid = item->m_cmd->id().toString();
             if (mapping.contains(sid)) {
                 item->m_key = mapping.value(sid);
+                item->m_keyText = keySequenceToEditString(item->m_key);
                 item->m_item->setText(2, item->m_key.toString(QKeySequence::NativeText));
                 if (item->m_item == commandList()->currentItem())
                     currentCommandChanged(item->m_item);
@@ -444,6 +446,7 @@ void ShortcutSettingsWidget::defaultAction()
 {
     foreach (ShortcutItem *item, m_scitems) {
         item->m_key = item->m_cmd->defaultKeySequence();
+        item->m_keyText = keySequenceToEditString(item->m_key);
         item->m_item->setText(2, item->m_key.toString(QKeySequence::NativeText));
         setModified(item->m_item, false);
         if (item->m_item == commandList()->currentItem())
@@ -509,6 +512,8 @@ void ShortcutSettingsWidget::initialize()
         sections[section]->addChild(item);
 
         s->m_key = c->keySequence();
+        s->m_idText = identifier;
+        s->m_keyText = keySequenceToEditString(s->m_key);
         item->setText(0, subId);
         item->setText(1, c->description());
         item->setText(2, s->m_key.toString(QKeySequence::NativeText));
@@ -54,6 +54,9 @@ struct ShortcutItem
     Command *m_cmd;
     QKeySequence m_key;
     QTreeWidgetItem *m_item;
+    // cached for filtering, to avoid re-deriving them on every keystroke
+    QString m_idText;
+    QString m_keyText;
 };
 
 class ShortcutButton : public QPushButton
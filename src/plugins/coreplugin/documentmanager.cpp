@@ -914,6 +914,20 @@ void DocumentManager::changedFile(const QString &fileName)
         QTimer::singleShot(200, this, &DocumentManager::checkForReload);
 }
 
+/* Returns true if the contents of the file on disk are identical to what the
+ * document would save. Used to suppress reload handling when only the time
+ * stamp changed, e.g. because a branch switch restored the same contents or
+ * the file was touched. A mismatch (also for files the document cannot
+ * reproduce byte-exactly, like different encodings) just means the regular
+ * reload handling runs as before. */
+static bool contentsUnchanged(IDocument *document)
+{
+    FileReader reader;
+    if (!reader.fetch(document->filePath().toString()))
+        return false;
+    return reader.data() == document->contents();
+}
+
 void DocumentManager::checkForReload()
 {
     if (d->m_changedFiles.isEmpty())
@@ -1043,6 +1057,11 @@ void DocumentManager::checkForReload()
         if (type == IDocument::TypePermissions) {
             // Only permission change
             success = document->reload(&errorString, IDocument::FlagReload, IDocument::TypePermissions);
+        } else if (type == IDocument::TypeContents && !document->isModified()
+                   && contentsUnchanged(document)) {
+            // The time stamp changed, but the bytes did not. The file info was
+            // already updated above, so there is nothing to reload and nothing
+            // to ask the user about.
         // now we know it's a content change or file was removed
         } else if (defaultBehavior == IDocument::ReloadUnmodified
                    && type == IDocument::TypeContents && !document->isModified()) {
@@ -74,6 +74,7 @@
 #include <QClipboard>
 #include <QDateTime>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QMap>
 #include <QRegularExpression>
@@ -1971,8 +1972,8 @@ void EditorManagerPrivate::editorAreaDestroyed(QObject *area)
 
 void EditorManagerPrivate::autoSave()
 {
-    QStringList errors;
-    // FIXME: the saving should be staggered
+    if (!d->m_autoSaveQueue.isEmpty())
+        return; // the previous pass is still being worked off
     foreach (IDocument *document, DocumentModel::openedDocuments()) {
         if (!document->isModified() || !document->shouldAutoSave())
             continue;
@@ -1981,13 +1982,37 @@ void EditorManagerPrivate::autoSave()
         if (document->filePath().isEmpty()
                 || !QFileInfo(savePath).isWritable()) // FIXME: save them to a dedicated directory
             continue;
+        d->m_autoSaveQueue.append(document);
+    }
+    d->m_autoSaveErrors.clear();
+    autoSaveNext();
+}
+
+void EditorManagerPrivate::autoSaveNext()
+{
+    // Save in time-boxed slices, so that a large number of modified documents
+    // does not block input for the length of the whole pass.
+    QElapsedTimer timer;
+    timer.start();
+    while (!d->m_autoSaveQueue.isEmpty()) {
+        if (timer.elapsed() > 50) {
+            QTimer::singleShot(0, d, &EditorManagerPrivate::autoSaveNext);
+            return;
+        }
+        const QPointer<IDocument> document = d->m_autoSaveQueue.takeFirst();
+        // the document may have been closed or saved since it was queued
+        if (!document || !document->isModified() || !document->shouldAutoSave()
+                || document->filePath().isEmpty())
+            continue;
         QString errorString;
-        if (!document->autoSave(&errorString, saveName))
-            errors << errorString;
+        if (!document->autoSave(&errorString, autoSaveName(document->filePath().toString())))
+            d->m_autoSaveErrors << errorString;
     }
-    if (!errors.isEmpty())
+    if (!d->m_autoSaveErrors.isEmpty()) {
         QMessageBox::critical(ICore::mainWindow(), tr("File Error"),
-                              errors.join(QLatin1Char('\n')));
+                              d->m_autoSaveErrors.join(QLatin1Char('\n')));
+        d->m_autoSaveErrors.clear();
+    }
     emit m_instance->autoSaved();
 }
 
@@ -156,6 +156,7 @@ private:
     static void gotoPreviousDocHistory();
 
     static void autoSave();
+    static void autoSaveNext();
     static void handleContextChange(const QList<Core::IContext *> &context);
 
     static void copyFilePathFromContextMenu();
@@ -210,6 +211,8 @@ private:
     QPointer<IEditor> m_scheduledCurrentEditor;
     QPointer<EditorView> m_currentView;
     QTimer *m_autoSaveTimer = nullptr;
+    QList<QPointer<IDocument>> m_autoSaveQueue;
+    QStringList m_autoSaveErrors;
 
     // actions
     QAction *m_revertToSavedAction;
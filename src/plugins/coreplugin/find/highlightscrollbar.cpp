@@ -45,6 +45,10 @@ public:
         , m_visibleRange(0.0)
         , m_offset(0.0)
         , m_cacheUpdateScheduled(false)
+        , m_rectsValid(false)
+        , m_cachedScrollbarRange(0)
+        , m_cachedVisibleRange(0.0)
+        , m_cachedOffset(0.0)
         , m_scrollBar(scrollBar)
     {}
 
@@ -63,6 +67,18 @@ protected:
     void paintEvent(QPaintEvent *paintEvent) override;
 
 private:
+    void updateHighlightRects(const QRect &rect, int scrollbarRange);
+
+    // The rects derived from m_cache, kept between paints. Scrolling repaints
+    // the overlay every frame; aggregating tens of thousands of marks each
+    // time made that visibly stutter.
+    QHash<Utils::Theme::Color, QVector<QRect> > m_highlightRects;
+    bool m_rectsValid;
+    QRect m_cachedRect;
+    int m_cachedScrollbarRange;
+    float m_cachedVisibleRange;
+    float m_cachedOffset;
+
     HighlightScrollBar *m_scrollBar;
 };
 
@@ -216,11 +232,14 @@ void HighlightScrollBarOverlay::updateCache()
     const QList<Id> &categories = m_highlights.keys();
     for (const Id &category : categories) {
         for (const Highlight &highlight : Utils::asConst(m_highlights[category])) {
-            Highlight oldHighlight = m_cache[highlight.position];
-            if (highlight.priority > oldHighlight.priority)
-                m_cache[highlight.position] = highlight;
+            const auto it = m_cache.find(highlight.position);
+            if (it == m_cache.end())
+                m_cache.insert(highlight.position, highlight);
+            else if (highlight.priority > it->priority)
+                *it = highlight;
         }
     }
+    m_rectsValid = false;
     m_cacheUpdateScheduled = false;
 }
 
@@ -239,12 +258,31 @@ void HighlightScrollBarOverlay::paintEvent(QPaintEvent *paintEvent)
         return;
 
     const QRect &rect = m_scrollBar->overlayRect();
+    const int scrollbarRange = m_scrollBar->maximum() + m_scrollBar->pageStep();
+    if (!m_rectsValid || rect != m_cachedRect || scrollbarRange != m_cachedScrollbarRange
+            || m_visibleRange != m_cachedVisibleRange || m_offset != m_cachedOffset) {
+        updateHighlightRects(rect, scrollbarRange);
+    }
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing, false);
+    foreach (Utils::Theme::Color themeColor, m_highlightRects.keys()) {
+        const QColor &color = creatorTheme()->color(themeColor);
+        for (int i = 0, total = m_highlightRects[themeColor].size(); i < total; ++i) {
+            const QRect rect = m_highlightRects[themeColor][i];
+            painter.fillRect(rect, color);
+        }
+    }
+}
+
+void HighlightScrollBarOverlay::updateHighlightRects(const QRect &rect, int scrollbarRange)
+{
+    m_highlightRects.clear();
 
     Utils::Theme::Color previousColor = Utils::Theme::TextColorNormal;
     Highlight::Priority previousPriority = Highlight::LowPriority;
     QRect *previousRect = 0;
 
-    const int scrollbarRange = m_scrollBar->maximum() + m_scrollBar->pageStep();
     const int range = qMax(m_visibleRange, float(scrollbarRange));
     const int horizontalMargin = 3;
     const int resultWidth = rect.width() - 2 * horizontalMargin + 1;
@@ -253,7 +291,6 @@ void HighlightScrollBarOverlay::paintEvent(QPaintEvent *paintEvent)
     const int verticalMargin = ((rect.height() / range) - resultHeight) / 2;
     int previousBottom = -1;
 
-    QHash<Utils::Theme::Color, QVector<QRect> > highlights;
     for (Highlight currentHighlight : Utils::asConst(m_cache)) {
         // Calculate top and bottom
         int top = rect.top() + offset + verticalMargin
@@ -279,27 +316,23 @@ void HighlightScrollBarOverlay::paintEvent(QPaintEvent *paintEvent)
                 } else {
                     previousRect->setBottom(top - 1); // move the end of the last highlight
                     if (previousRect->height() == 0) // if the result is an empty rect, remove it.
-                        highlights[previousColor].removeLast();
+                        m_highlightRects[previousColor].removeLast();
                 }
             }
-            highlights[currentHighlight.color] << QRect(rect.left() + horizontalMargin, top,
-                                                        resultWidth, bottom - top);
-            previousRect = &highlights[currentHighlight.color].last();
+            m_highlightRects[currentHighlight.color] << QRect(rect.left() + horizontalMargin, top,
+                                                              resultWidth, bottom - top);
+            previousRect = &m_highlightRects[currentHighlight.color].last();
             previousColor = currentHighlight.color;
             previousPriority = currentHighlight.priority;
         }
         previousBottom = previousRect->bottom();
     }
 
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing, false);
-    foreach (Utils::Theme::Color themeColor, highlights.keys()) {
-        const QColor &color = creatorTheme()->color(themeColor);
-        for (int i = 0, total = highlights[themeColor].size(); i < total; ++i) {
-            const QRect rect = highlights[themeColor][i];
-            painter.fillRect(rect, color);
-        }
-    }
+    m_rectsValid = true;
+    m_cachedRect = rect;
+    m_cachedScrollbarRange = scrollbarRange;
+    m_cachedVisibleRange = m_visibleRange;
+    m_cachedOffset = m_offset;
 }
 
 Highlight::Highlight(Id category_, int position_,
@@ -32,6 +32,7 @@ SearchResultTreeItem::SearchResultTreeItem(const SearchResultItem &item,
                                            SearchResultTreeItem *parent)
   : item(item),
   m_parent(parent),
+  m_row(0),
   m_isGenerated(false),
   m_checkState(Qt::Checked)
 {
@@ -70,7 +71,10 @@ int SearchResultTreeItem::childrenCount() const
 
 int SearchResultTreeItem::rowOfItem() const
 {
-    return (m_parent ? m_parent->m_children.indexOf(const_cast<SearchResultTreeItem*>(this)):0);
+    // The row is cached because the views ask for it via parent() for every
+    // single index; a linear indexOf here is quadratic over the children of
+    // a file with many hits.
+    return (m_parent ? m_row : 0);
 }
 
 SearchResultTreeItem* SearchResultTreeItem::childAt(int index) const
@@ -108,7 +112,10 @@ int SearchResultTreeItem::insertionIndex(const SearchResultItem &item, SearchRes
 
 void SearchResultTreeItem::insertChild(int index, SearchResultTreeItem *child)
 {
+    child->m_row = index;
     m_children.insert(index, child);
+    for (int i = index + 1; i < m_children.count(); ++i)
+        m_children.at(i)->m_row = i;
 }
 
 void SearchResultTreeItem::insertChild(int index, const SearchResultItem &item)
@@ -122,5 +129,10 @@ void SearchResultTreeItem::appendChild(const SearchResultItem &item)
     insertChild(m_children.count(), item);
 }
 
+void SearchResultTreeItem::reserveChildren(int count)
+{
+    m_children.reserve(m_children.count() + count);
+}
+
 } // namespace Internal
 } // namespace Core
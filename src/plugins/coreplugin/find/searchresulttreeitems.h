@@ -48,6 +48,7 @@ public:
     void insertChild(int index, SearchResultTreeItem *child);
     void insertChild(int index, const SearchResultItem &item);
     void appendChild(const SearchResultItem &item);
+    void reserveChildren(int count);
     int childrenCount() const;
     int rowOfItem() const;
     void clearChildren();
@@ -63,6 +64,7 @@ public:
 private:
     SearchResultTreeItem *m_parent;
     QList<SearchResultTreeItem *> m_children;
+    int m_row; // cached position in m_parent->m_children
     bool m_isGenerated;
     Qt::CheckState m_checkState;
 };
@@ -343,6 +343,7 @@ void SearchResultTreeModel::addResultsToCurrentParent(const QList<SearchResultIt
 
     if (mode == SearchResult::AddOrdered) {
         // this is the mode for e.g. text search
+        m_currentParent->reserveChildren(items.count());
         beginInsertRows(m_currentIndex, m_currentParent->childrenCount(), m_currentParent->childrenCount() + items.count());
         foreach (const SearchResultItem &item, items) {
             m_currentParent->appendChild(item);
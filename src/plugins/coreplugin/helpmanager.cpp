@@ -30,6 +30,7 @@
 #include <utils/filesystemwatcher.h>
 #include <utils/qtcassert.h>
 
+#include <QCache>
 #include <QDateTime>
 #include <QDebug>
 #include <QDir>
@@ -53,7 +54,8 @@ namespace Core {
 struct HelpManagerPrivate
 {
     HelpManagerPrivate() :
-       m_needsSetup(true), m_helpEngine(0), m_collectionWatcher(0)
+       m_needsSetup(true), m_helpEngine(0), m_collectionWatcher(0),
+       m_linksCache(1000)
     {}
 
     QStringList documentationFromInstaller();
@@ -70,6 +72,10 @@ struct HelpManagerPrivate
     QSet<QString> m_nameSpacesToUnregister;
     QHash<QString, QVariant> m_customValues;
 
+    // Memoizes linksForIdentifier(), which runs a query per registered
+    // namespace. Flushed whenever the registered documentation changes.
+    QCache<QString, QMap<QString, QUrl> > m_linksCache;
+
     QSet<QString> m_userRegisteredFiles;
 };
 
@@ -130,13 +136,17 @@ void HelpManager::registerDocumentation(const QStringList &files)
     }
 
     bool docsChanged = false;
+    // registeredDocumentations() queries the collection database, so fetch
+    // the list once instead of for every file.
+    QStringList registeredDocs = d->m_helpEngine->registeredDocumentations();
     foreach (const QString &file, files) {
         const QString &nameSpace = d->m_helpEngine->namespaceName(file);
         if (nameSpace.isEmpty())
             continue;
-        if (!d->m_helpEngine->registeredDocumentations().contains(nameSpace)) {
+        if (!registeredDocs.contains(nameSpace)) {
             if (d->m_helpEngine->registerDocumentation(file)) {
                 docsChanged = true;
+                registeredDocs.append(nameSpace);
             } else {
                 qWarning() << "Error registering namespace '" << nameSpace
                     << "' from file '" << file << "':" << d->m_helpEngine->error();
@@ -155,8 +165,10 @@ void HelpManager::registerDocumentation(const QStringList &files)
             }
         }
     }
-    if (docsChanged)
+    if (docsChanged) {
+        d->m_linksCache.clear();
         emit m_instance->documentationChanged();
+    }
 }
 
 void HelpManager::unregisterDocumentation(const QStringList &nameSpaces)
@@ -179,8 +191,10 @@ void HelpManager::unregisterDocumentation(const QStringList &nameSpaces)
                 << "': " << d->m_helpEngine->error();
         }
     }
-    if (docsChanged)
+    if (docsChanged) {
+        d->m_linksCache.clear();
         emit m_instance->documentationChanged();
+    }
 }
 
 void HelpManager::registerUserDocumentation(const QStringList &filePaths)
@@ -243,7 +257,13 @@ QMap<QString, QUrl> HelpManager::linksForIdentifier(const QString &id)
 {
     QMap<QString, QUrl> empty;
     QTC_ASSERT(!d->m_needsSetup, return empty);
-    return d->m_helpEngine->linksForIdentifier(id);
+    // The tooltip machinery tries several candidate ids per hover, so also
+    // negative results have to be remembered to keep hovering fluent.
+    if (const QMap<QString, QUrl> *cached = d->m_linksCache.object(id))
+        return *cached;
+    const QMap<QString, QUrl> links = d->m_helpEngine->linksForIdentifier(id);
+    d->m_linksCache.insert(id, new QMap<QString, QUrl>(links));
+    return links;
 }
 
 QUrl HelpManager::findFile(const QUrl &url)
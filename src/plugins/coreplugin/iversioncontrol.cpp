@@ -106,6 +106,17 @@ IVersionControl::OpenSupportMode IVersionControl::openSupportMode(const QString
     return NoOpen;
 }
 
+QStringList IVersionControl::unmanagedFiles(const QString &workingDirectory,
+                                            const QStringList &filePaths) const
+{
+    QStringList unmanaged;
+    foreach (const QString &filePath, filePaths) {
+        if (!managesFile(workingDirectory, filePath))
+            unmanaged.append(filePath);
+    }
+    return unmanaged;
+}
+
 IVersionControl::TopicCache::~TopicCache()
 {
 }
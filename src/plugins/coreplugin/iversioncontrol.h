@@ -123,6 +123,19 @@ public:
      */
     virtual bool managesFile(const QString &workingDirectory, const QString &fileName) const = 0;
 
+    /*!
+     * Returns the subset of \a filePaths that is not managed by this version control.
+     *
+     * The \a workingDirectory is assumed to be part of a valid repository (not necessarily its
+     * top level). The file paths are expected to be relative to it.
+     *
+     * The default implementation checks the files one by one with managesFile().
+     * Reimplement this if the VCS can answer for a whole batch of files with a
+     * single query.
+     */
+    virtual QStringList unmanagedFiles(const QString &workingDirectory,
+                                       const QStringList &filePaths) const;
+
     /*!
      * Returns true is the VCS is configured to run.
      */
@@ -26,6 +26,7 @@
 #include "basefilefilter.h"
 
 #include <coreplugin/editormanager/editormanager.h>
+#include <utils/algorithm.h>
 #include <utils/fileutils.h>
 #include <utils/qtcassert.h>
 
@@ -40,18 +41,128 @@ using namespace Utils;
 namespace Core {
 namespace Internal {
 
+// Index over the lower-cased file paths of an Iterator: maps each trigram
+// (three consecutive characters) to the sorted list of files whose path
+// contains it. A plain substring query of at least three characters is then
+// answered by intersecting the posting lists of its trigrams, so the
+// per-entry matcher only runs on the surviving candidates instead of on
+// every file of the project.
+class TrigramIndex
+{
+public:
+    TrigramIndex() : m_built(false) {}
+
+    bool isBuilt() const { return m_built; }
+
+    void build(BaseFileFilter::Iterator *iterator,
+               QFutureInterface<LocatorFilterEntry> &future)
+    {
+        // A canceled build leaves partial contents behind; start from
+        // scratch so the retry does not duplicate files and postings.
+        m_filePaths.clear();
+        m_fileNames.clear();
+        m_postings.clear();
+
+        iterator->toFront();
+        while (iterator->hasNext()) {
+            if (future.isCanceled())
+                return; // try again on the next search
+            iterator->next();
+            const int fileIndex = m_filePaths.size();
+            m_filePaths.append(iterator->filePath());
+            m_fileNames.append(iterator->fileName());
+            foreach (quint64 trigram, trigramsOf(m_filePaths.at(fileIndex)))
+                m_postings[trigram].append(fileIndex);
+        }
+        m_built = true;
+    }
+
+    // Collects the files whose path contains all trigrams of query. The
+    // result is a superset of the real matches (the index is case-insensitive
+    // and covers full paths), so the caller still has to run its matcher on
+    // each candidate. Returns false if the query is too short for the index.
+    bool matches(const QString &query, QStringList *candidatePaths,
+                 QStringList *candidateNames) const
+    {
+        const QSet<quint64> trigrams = trigramsOf(query);
+        if (trigrams.isEmpty())
+            return false;
+
+        QList<const QVector<int> *> postings;
+        foreach (quint64 trigram, trigrams) {
+            const QHash<quint64, QVector<int> >::ConstIterator it
+                    = m_postings.constFind(trigram);
+            if (it == m_postings.constEnd())
+                return true; // a trigram occurs nowhere: no candidates at all
+            postings.append(&it.value());
+        }
+        Utils::sort(postings, [](const QVector<int> *a, const QVector<int> *b) {
+            return a->size() < b->size();
+        });
+
+        QVector<int> candidates = *postings.first();
+        for (int i = 1; i < postings.size() && !candidates.isEmpty(); ++i)
+            candidates = intersectSorted(candidates, *postings.at(i));
+
+        foreach (int fileIndex, candidates) {
+            candidatePaths->append(m_filePaths.at(fileIndex));
+            candidateNames->append(m_fileNames.at(fileIndex));
+        }
+        return true;
+    }
+
+private:
+    static QSet<quint64> trigramsOf(const QString &string)
+    {
+        QSet<quint64> result;
+        const QString lowered = string.toLower();
+        for (int i = 0, end = lowered.size() - 3; i <= end; ++i) {
+            result.insert((quint64(lowered.at(i).unicode()) << 32)
+                          | (quint64(lowered.at(i + 1).unicode()) << 16)
+                          | quint64(lowered.at(i + 2).unicode()));
+        }
+        return result;
+    }
+
+    static QVector<int> intersectSorted(const QVector<int> &a, const QVector<int> &b)
+    {
+        QVector<int> result;
+        int i = 0;
+        int j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a.at(i) < b.at(j)) {
+                ++i;
+            } else if (a.at(i) > b.at(j)) {
+                ++j;
+            } else {
+                result.append(a.at(i));
+                ++i;
+                ++j;
+            }
+        }
+        return result;
+    }
+
+    QStringList m_filePaths;
+    QStringList m_fileNames;
+    QHash<quint64, QVector<int> > m_postings;
+    bool m_built;
+};
+
 class Data
 {
 public:
     void clear()
     {
         iterator.clear();
+        index.clear();
         previousResultPaths.clear();
         previousResultNames.clear();
         previousEntry.clear();
     }
 
     QSharedPointer<BaseFileFilter::Iterator> iterator;
+    QSharedPointer<TrigramIndex> index;
     QStringList previousResultPaths;
     QStringList previousResultNames;
     bool forceNewSearchList;
@@ -87,6 +198,7 @@ void BaseFileFilter::prepareSearch(const QString &entry)
 {
     Q_UNUSED(entry)
     d->m_current.iterator = d->m_data.iterator;
+    d->m_current.index = d->m_data.index;
     d->m_current.previousResultPaths = d->m_data.previousResultPaths;
     d->m_current.previousResultNames = d->m_data.previousResultNames;
     d->m_current.forceNewSearchList = d->m_data.forceNewSearchList;
@@ -116,9 +228,22 @@ QList<LocatorFilterEntry> BaseFileFilter::matchesFor(QFutureInterface<LocatorFil
             && fp.filePath.contains(pathSeparator);
     const bool searchInPreviousResults = !d->m_current.forceNewSearchList && containsPreviousEntry
             && !pathSeparatorAdded;
-    if (searchInPreviousResults)
+    if (searchInPreviousResults) {
         d->m_current.iterator.reset(new ListIterator(d->m_current.previousResultPaths,
                                                      d->m_current.previousResultNames));
+    } else if (!hasWildcard && d->m_current.index && d->m_current.iterator) {
+        // Answer plain substring queries from the trigram index instead of
+        // scanning every file. Matching against file names only is covered
+        // too, since the trigrams of a name are a subset of those of its path.
+        if (!d->m_current.index->isBuilt())
+            d->m_current.index->build(d->m_current.iterator.data(), future);
+        QStringList candidatePaths;
+        QStringList candidateNames;
+        if (d->m_current.index->isBuilt()
+                && d->m_current.index->matches(fp.filePath, &candidatePaths, &candidateNames)) {
+            d->m_current.iterator.reset(new ListIterator(candidatePaths, candidateNames));
+        }
+    }
 
     QTC_ASSERT(d->m_current.iterator.data(), return QList<LocatorFilterEntry>());
     d->m_current.previousResultPaths.clear();
@@ -200,6 +325,7 @@ void BaseFileFilter::setFileIterator(BaseFileFilter::Iterator *iterator)
     d->m_data.clear();
     d->m_data.forceNewSearchList = true;
     d->m_data.iterator.reset(iterator);
+    d->m_data.index.reset(new Internal::TrigramIndex); // built lazily on first search
 }
 
 QSharedPointer<BaseFileFilter::Iterator> BaseFileFilter::fileIterator()
@@ -266,8 +266,12 @@ void OutputPaneManager::init()
     const Id baseId = "QtCreator.Pane.";
     for (int i = 0; i != n; ++i) {
         IOutputPane *outPane = m_panes.at(i);
-        const int idx = m_outputWidgetPane->addWidget(outPane->outputWidget(this));
+        // The pane's actual widget and tool bar buttons are created lazily on
+        // first show (ensurePageWidget()); until then empty placeholders keep
+        // the indexes of the stacked widgets stable.
+        const int idx = m_outputWidgetPane->addWidget(new QWidget);
         QTC_CHECK(idx == i);
+        m_pageCreated.append(false);
 
         connect(outPane, &IOutputPane::showPage, this, [this, outPane](int flags) {
             showPage(findIndexForPage(outPane), flags);
@@ -283,9 +287,6 @@ void OutputPaneManager::init()
         QHBoxLayout *toolButtonsLayout = new QHBoxLayout;
         toolButtonsLayout->setMargin(0);
         toolButtonsLayout->setSpacing(0);
-        foreach (QWidget *toolButton, outPane->toolBarWidgets())
-            toolButtonsLayout->addWidget(toolButton);
-        toolButtonsLayout->addStretch(5);
         toolButtonsContainer->setLayout(toolButtonsLayout);
 
         m_opToolBarWidgets->addWidget(toolButtonsContainer);
@@ -450,6 +451,24 @@ void OutputPaneManager::ensurePageVisible(int idx)
     setCurrentIndex(idx);
 }
 
+void OutputPaneManager::ensurePageWidget(int idx)
+{
+    if (m_pageCreated.at(idx))
+        return;
+    m_pageCreated[idx] = true;
+    IOutputPane *outPane = m_panes.at(idx);
+
+    QWidget *placeholder = m_outputWidgetPane->widget(idx);
+    m_outputWidgetPane->insertWidget(idx, outPane->outputWidget(this));
+    delete placeholder;
+
+    QHBoxLayout *toolButtonsLayout
+            = static_cast<QHBoxLayout *>(m_opToolBarWidgets->widget(idx)->layout());
+    foreach (QWidget *toolButton, outPane->toolBarWidgets())
+        toolButtonsLayout->addWidget(toolButton);
+    toolButtonsLayout->addStretch(5);
+}
+
 void OutputPaneManager::updateNavigateState()
 {
     IOutputPane *pane = qobject_cast<IOutputPane*>(sender());
@@ -538,6 +557,7 @@ void OutputPaneManager::setCurrentIndex(int idx)
     }
 
     if (idx != -1) {
+        ensurePageWidget(idx);
         m_outputWidgetPane->setCurrentIndex(idx);
         m_opToolBarWidgets->setCurrentIndex(idx);
 
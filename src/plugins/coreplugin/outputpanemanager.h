@@ -94,6 +94,7 @@ private:
     void setBadgeNumber(int number);
     void showPage(int idx, int flags);
     void ensurePageVisible(int idx);
+    void ensurePageWidget(int idx);
     int findIndexForPage(IOutputPane *out);
     int currentIndex() const;
     void setCurrentIndex(int idx);
@@ -119,6 +120,7 @@ private:
     QVector<OutputPaneToggleButton *> m_buttons;
     QVector<QAction *> m_actions;
     QVector<Id> m_ids;
+    QVector<bool> m_pageCreated;
     QMap<Id, bool> m_buttonVisibility;
 
     QStackedWidget *m_outputWidgetPane;
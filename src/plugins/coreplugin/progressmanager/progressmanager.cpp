@@ -275,6 +275,12 @@ ProgressManagerPrivate::ProgressManagerPrivate()
 {
     m_opacityEffect->setOpacity(1);
     m_instance = this;
+    // Compress the progress value storms of fast-reporting tasks into one
+    // summary update per interval; the views cannot usefully show more anyhow.
+    m_summaryUpdateTimer.setSingleShot(true);
+    m_summaryUpdateTimer.setInterval(50);
+    connect(&m_summaryUpdateTimer, &QTimer::timeout,
+            this, &ProgressManagerPrivate::updateSummaryProgressBar);
     m_progressView = new ProgressView;
     // withDelay, so the statusBarWidget has the chance to get the enter event
     connect(m_progressView.data(), &ProgressView::hoveredChanged, this, &ProgressManagerPrivate::updateVisibilityWithDelay);
@@ -421,9 +427,9 @@ FutureProgress *ProgressManagerPrivate::doAddTask(const QFuture<void> &future, c
     QFutureWatcher<void> *watcher = new QFutureWatcher<void>();
     m_runningTasks.insert(watcher, type);
     connect(watcher, &QFutureWatcherBase::progressRangeChanged,
-            this, &ProgressManagerPrivate::updateSummaryProgressBar);
+            this, &ProgressManagerPrivate::scheduleUpdateSummaryProgressBar);
     connect(watcher, &QFutureWatcherBase::progressValueChanged,
-            this, &ProgressManagerPrivate::updateSummaryProgressBar);
+            this, &ProgressManagerPrivate::scheduleUpdateSummaryProgressBar);
     connect(watcher, &QFutureWatcherBase::finished, this, &ProgressManagerPrivate::taskFinished);
     watcher->setFuture(future);
 
@@ -500,6 +506,12 @@ void ProgressManagerPrivate::disconnectApplicationTask()
     m_applicationTask = 0;
 }
 
+void ProgressManagerPrivate::scheduleUpdateSummaryProgressBar()
+{
+    if (!m_summaryUpdateTimer.isActive())
+        m_summaryUpdateTimer.start();
+}
+
 void ProgressManagerPrivate::updateSummaryProgressBar()
 {
     m_summaryProgressBar->setError(hasError());
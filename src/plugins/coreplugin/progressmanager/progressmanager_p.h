@@ -33,6 +33,7 @@
 #include <QHBoxLayout>
 #include <QPointer>
 #include <QPropertyAnimation>
+#include <QTimer>
 #include <QToolButton>
 
 namespace Core {
@@ -72,6 +73,7 @@ private:
     void setApplicationProgressValue(int value);
     void setApplicationProgressVisible(bool visible);
     void disconnectApplicationTask();
+    void scheduleUpdateSummaryProgressBar();
     void updateSummaryProgressBar();
     void fadeAwaySummaryProgress();
     void summaryProgressFinishedFading();
@@ -106,6 +108,7 @@ private:
     ProgressBar *m_summaryProgressBar;
     QGraphicsOpacityEffect *m_opacityEffect;
     QPointer<QPropertyAnimation> m_opacityAnimation;
+    QTimer m_summaryUpdateTimer;
     bool m_progressViewPinned;
     bool m_hovered;
 };
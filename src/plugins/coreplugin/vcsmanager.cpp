@@ -41,6 +41,7 @@
 #include <utils/qtcassert.h>
 
 #include <QDir>
+#include <QSet>
 #include <QString>
 #include <QList>
 #include <QMap>
@@ -99,9 +100,14 @@ public:
         QTC_ASSERT(QDir::fromNativeSeparators(dir) == dir, return);
 
         const QString dirSlash = dir + QLatin1Char('/');
-        foreach (const QString &key, m_cachedMatches.keys()) {
-            if (key == dir || key.startsWith(dirSlash))
-                m_cachedMatches.remove(key);
+        // the affected entries share the prefix dir and are therefore
+        // contiguous in the ordered map; don't scan all cached directories
+        auto it = m_cachedMatches.lowerBound(dir);
+        while (it != m_cachedMatches.end() && it.key().startsWith(dir)) {
+            if (it.key() == dir || it.key().startsWith(dirSlash))
+                it = m_cachedMatches.erase(it);
+            else
+                ++it; // e.g. a sibling like "dir.bak" sorting inside the range
         }
     }
 
@@ -400,11 +406,16 @@ void VcsManager::promptToAdd(const QString &directory, const QStringList &fileNa
     if (!vc || !vc->supportsOperation(IVersionControl::AddOperation))
         return;
 
-    QStringList unmanagedFiles;
     QDir dir(directory);
-    foreach (const QString &fileName, fileNames) {
-        if (!vc->managesFile(directory, dir.relativeFilePath(fileName)))
-            unmanagedFiles << fileName;
+    QStringList relativeFiles;
+    foreach (const QString &fileName, fileNames)
+        relativeFiles << dir.relativeFilePath(fileName);
+    // one batched query instead of one external process per file
+    const QSet<QString> unmanagedSet = vc->unmanagedFiles(directory, relativeFiles).toSet();
+    QStringList unmanagedFiles;
+    for (int i = 0; i < fileNames.count(); ++i) {
+        if (unmanagedSet.contains(relativeFiles.at(i)))
+            unmanagedFiles << fileNames.at(i);
     }
     if (unmanagedFiles.isEmpty())
         return;
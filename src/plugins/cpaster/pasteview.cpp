@@ -103,7 +103,22 @@ QString PasteView::protocol() const
 
 void PasteView::contentChanged()
 {
-    m_ui.uiPatchView->setPlainText(content());
+    setPatchPreview(content());
+}
+
+void PasteView::setPatchPreview(const QString &content)
+{
+    // The patch view only previews what will be pasted; putting many
+    // megabytes into it makes the dialog take seconds to open without
+    // showing anything useful. The full content is still sent on accept.
+    enum { MaxPreviewSize = 1024 * 1024 };
+    if (content.size() <= int(MaxPreviewSize)) {
+        m_ui.uiPatchView->setPlainText(content);
+    } else {
+        m_ui.uiPatchView->setPlainText(content.left(MaxPreviewSize)
+            + tr("\n[%1 more characters, not shown in the preview]")
+              .arg(content.size() - int(MaxPreviewSize)));
+    }
 }
 
 void PasteView::protocolChanged(int p)
@@ -156,7 +171,7 @@ int PasteView::show(const QString &user, const QString &description,
         content += part.content;
     }
     m_ui.stackedWidget->setCurrentIndex(0);
-    m_ui.uiPatchView->setPlainText(content);
+    setPatchPreview(content);
     setExpiryDays(expiryDays);
     return showDialog();
 }
@@ -73,6 +73,7 @@ private:
     void contentChanged();
     void protocolChanged(int);
 
+    void setPatchPreview(const QString &content);
     void setupDialog(const QString &user, const QString &description, const QString &comment);
     int showDialog();
 
@@ -89,6 +89,7 @@
 #include <QFutureWatcher>
 #include <QMenu>
 #include <QPointer>
+#include <QSharedPointer>
 #include <QTextEdit>
 #include <QTimer>
 #include <QToolButton>
@@ -766,7 +767,18 @@ void CppEditorWidget::contextMenuEvent(QContextMenuEvent *e)
     QMenu *quickFixMenu = new QMenu(tr("&Refactor"), menu);
     quickFixMenu->addAction(ActionManager::command(Constants::RENAME_SYMBOL_UNDER_CURSOR)->action());
 
-    if (isSemanticInfoValidExceptLocalUses()) {
+    // Running the quick fix factories can take noticeable time since some of
+    // them consult the symbol index, so collect the fixes only once the
+    // submenu is actually opened instead of delaying the whole context menu.
+    const QSharedPointer<bool> quickFixesCollected(new bool(false));
+    connect(quickFixMenu, &QMenu::aboutToShow, this, [this, quickFixMenu, quickFixesCollected] {
+        if (*quickFixesCollected)
+            return;
+        *quickFixesCollected = true;
+
+        if (!isSemanticInfoValidExceptLocalUses())
+            return;
+
         d->m_useSelectionsUpdater.update(CppUseSelectionsUpdater::Synchronous);
         AssistInterface *interface = createAssistInterface(QuickFix, ExplicitlyInvoked);
         if (interface) {
@@ -784,7 +796,7 @@ void CppEditorWidget::contextMenuEvent(QContextMenuEvent *e)
                 delete model;
             }
         }
-    }
+    });
 
     foreach (QAction *action, contextMenu->actions()) {
         menu->addAction(action);
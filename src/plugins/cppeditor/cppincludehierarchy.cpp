@@ -72,32 +72,25 @@ static Snapshot globalSnapshot()
     return CppModelManager::instance()->snapshot();
 }
 
-struct FileAndLine
+FileAndLines CppIncludeHierarchyModel::findIncluders(const QString &filePath)
 {
-    FileAndLine() {}
-    FileAndLine(const QString &f, int l) : file(f), line(l) {}
-
-    QString file;
-    int line = 0;
-};
-
-using FileAndLines = QList<FileAndLine>;
-
-static FileAndLines findIncluders(const QString &filePath)
-{
-    FileAndLines result;
-    const Snapshot snapshot = globalSnapshot();
-    for (auto cit = snapshot.begin(), citEnd = snapshot.end(); cit != citEnd; ++cit) {
-        const QString filePathFromSnapshot = cit.key().toString();
-        Document::Ptr doc = cit.value();
-        const QList<Document::Include> resolvedIncludes = doc->resolvedIncludes();
-        for (const auto &includeFile : resolvedIncludes) {
-            const QString includedFilePath = includeFile.resolvedFileName();
-            if (includedFilePath == filePath)
-                result.append(FileAndLine(filePathFromSnapshot, int(includeFile.line())));
+    // One pass over the snapshot builds the reverse include map for the whole
+    // hierarchy, so "who includes this file" is a lookup per expanded item
+    // instead of a scan over all documents of the snapshot.
+    QHash<QString, FileAndLines> &includersByFile = m_includersByFile;
+    if (includersByFile.isEmpty()) {
+        const Snapshot snapshot = globalSnapshot();
+        for (auto cit = snapshot.begin(), citEnd = snapshot.end(); cit != citEnd; ++cit) {
+            const QString filePathFromSnapshot = cit.key().toString();
+            Document::Ptr doc = cit.value();
+            const QList<Document::Include> resolvedIncludes = doc->resolvedIncludes();
+            for (const auto &includeFile : resolvedIncludes) {
+                includersByFile[includeFile.resolvedFileName()].append(
+                            FileAndLine(filePathFromSnapshot, int(includeFile.line())));
+            }
         }
     }
-    return result;
+    return includersByFile.value(filePath);
 }
 
 static FileAndLines findIncludes(const QString &filePath, const Snapshot &snapshot)
@@ -228,9 +221,9 @@ void CppIncludeHierarchyItem::fetchMore()
             createChild(include.file, InIncludes, include.line, definitelyNoChildren);
         }
     } else if (m_subTree == InIncludedBy) {
-        const FileAndLines includers = findIncluders(filePath());
+        const FileAndLines includers = model()->findIncluders(filePath());
         for (const FileAndLine &includer : includers) {
-            const FileAndLines subIncluders = findIncluders(includer.file);
+            const FileAndLines subIncluders = model()->findIncluders(includer.file);
             bool definitelyNoChildren = subIncluders.isEmpty();
             createChild(includer.file, InIncludedBy, includer.line, definitelyNoChildren);
         }
@@ -240,6 +233,7 @@ void CppIncludeHierarchyItem::fetchMore()
 void CppIncludeHierarchyModel::buildHierarchy(const QString &document)
 {
     m_editorFilePath = document;
+    m_includersByFile.clear(); // the snapshot may have changed, rebuild lazily
     rootItem()->removeChildren();
     rootItem()->createChild(tr("Includes"), CppIncludeHierarchyItem::InIncludes);
     rootItem()->createChild(tr("Included by"), CppIncludeHierarchyItem::InIncludedBy);
@@ -28,6 +28,8 @@
 #include <coreplugin/inavigationwidgetfactory.h>
 #include <utils/treemodel.h>
 
+#include <QHash>
+#include <QList>
 #include <QSet>
 
 namespace CppEditor {
@@ -35,6 +37,17 @@ namespace Internal {
 
 class CppIncludeHierarchyItem;
 
+struct FileAndLine
+{
+    FileAndLine() {}
+    FileAndLine(const QString &f, int l) : file(f), line(l) {}
+
+    QString file;
+    int line = 0;
+};
+
+using FileAndLines = QList<FileAndLine>;
+
 class CppIncludeHierarchyModel : public Utils::TreeModel<CppIncludeHierarchyItem>
 {
     Q_OBJECT
@@ -59,8 +72,11 @@ public:
 
 private:
     friend class CppIncludeHierarchyItem;
+    FileAndLines findIncluders(const QString &filePath);
     QString m_editorFilePath;
     QSet<QString> m_seen;
+    // Reverse include map of the snapshot, built on first use per hierarchy.
+    QHash<QString, FileAndLines> m_includersByFile;
     bool m_searching = false;
 };
 
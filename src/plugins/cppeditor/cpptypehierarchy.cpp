@@ -32,10 +32,12 @@
 
 #include <coreplugin/find/itemviewfind.h>
 #include <coreplugin/editormanager/editormanager.h>
+#include <cpptools/cppmodelmanager.h>
 #include <utils/algorithm.h>
 #include <utils/annotateditemdelegate.h>
 #include <utils/navigationtreeview.h>
 #include <utils/dropsupport.h>
+#include <utils/runextensions.h>
 
 #include <QApplication>
 #include <QLabel>
@@ -147,7 +149,6 @@ void CppTypeHierarchyWidget::perform()
 
     CppElementEvaluator evaluator(widget);
     evaluator.setLookupBaseClasses(true);
-    evaluator.setLookupDerivedClasses(true);
     evaluator.execute();
     if (evaluator.identifiedCppElement()) {
         const QSharedPointer<CppElement> &cppElement = evaluator.cppElement();
@@ -158,12 +159,33 @@ void CppTypeHierarchyWidget::perform()
             QStandardItem *bases = new QStandardItem(tr("Bases"));
             m_model->invisibleRootItem()->appendRow(bases);
             buildHierarchy(*cppClass, bases, true, &CppClass::bases);
-            QStandardItem *derived = new QStandardItem(tr("Derived"));
-            m_model->invisibleRootItem()->appendRow(derived);
-            buildHierarchy(*cppClass, derived, true, &CppClass::derived);
             m_treeView->expandAll();
 
             showTypeHierarchy();
+
+            // Collecting the derived classes walks all documents depending on
+            // the inspected one, which can take seconds in a large session, so
+            // do it in a worker thread and fill in the tree once the result
+            // arrives. The snapshot is captured by value to keep the symbols
+            // alive while the walk is running.
+            const int requestId = ++m_derivedRequestId;
+            const CPlusPlus::Snapshot snapshot
+                    = CppTools::CppModelManager::instance()->snapshot();
+            const CppClass inspectedClass = *cppClass;
+            QFuture<CppClass> future
+                    = Utils::runAsync([inspectedClass, snapshot]() -> CppClass {
+                CppClass cppClass = inspectedClass;
+                cppClass.lookupDerived(cppClass.declaration, snapshot);
+                return cppClass;
+            });
+            Utils::onResultReady(future, this, [this, requestId](const CppClass &cppClass) {
+                if (requestId != m_derivedRequestId)
+                    return; // a newer request was started in the meantime
+                QStandardItem *derived = new QStandardItem(tr("Derived"));
+                m_model->invisibleRootItem()->appendRow(derived);
+                buildHierarchy(cppClass, derived, true, &CppClass::derived);
+                m_treeView->expandAll();
+            });
         }
     }
 }
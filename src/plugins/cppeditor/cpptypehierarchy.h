@@ -95,6 +95,7 @@ private:
     Utils::AnnotatedItemDelegate *m_delegate = nullptr;
     TextEditor::TextEditorLinkLabel *m_inspectedClass = nullptr;
     QLabel *m_noTypeHierarchyAvailableLabel = nullptr;
+    int m_derivedRequestId = 0; // invalidates pending results on a new request
 };
 
 class CppTypeHierarchyFactory : public Core::INavigationWidgetFactory
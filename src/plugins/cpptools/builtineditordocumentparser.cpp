@@ -131,8 +131,9 @@ void BuiltinEditorDocumentParser::updateImpl(const QFutureInterface<void> &futur
     }
 
     unsigned rev = 0;
-    if (Document::Ptr doc = state.snapshot.document(filePath()))
-        rev = doc->revision();
+    const Document::Ptr previousDocument = state.snapshot.document(filePath());
+    if (previousDocument)
+        rev = previousDocument->revision();
     else
         invalidateSnapshot = true;
 
@@ -196,6 +197,14 @@ void BuiltinEditorDocumentParser::updateImpl(const QFutureInterface<void> &futur
 
         Snapshot globalSnapshot = modelManager->snapshot();
         globalSnapshot.remove(filePath());
+        // The globally indexed document was preprocessed without the editor
+        // defines, so it must not be reused for the file in the editor. The
+        // parser's own previous document was, though. Offering it lets the
+        // source processor skip parsing and checking when an update - undoing
+        // an edit, toggling a define that does not affect this file - leaves
+        // the preprocessed content unchanged.
+        if (previousDocument)
+            globalSnapshot.insert(previousDocument);
         sourceProcessor.setGlobalSnapshot(globalSnapshot);
         sourceProcessor.setWorkingCopy(workingCopy);
         sourceProcessor.setHeaderPaths(state.headerPaths);
@@ -166,6 +166,7 @@ BuiltinEditorDocumentProcessor::BuiltinEditorDocumentProcessor(
     : BaseEditorDocumentProcessor(document->document(), document->filePath().toString())
     , m_parser(new BuiltinEditorDocumentParser(document->filePath().toString()))
     , m_codeWarningsUpdated(false)
+    , m_seededFromGlobalSnapshot(false)
     , m_semanticHighlighter(enableSemanticHighlighter
                             ? new CppTools::SemanticHighlighter(document)
                             : 0)
@@ -208,6 +209,11 @@ BuiltinEditorDocumentProcessor::~BuiltinEditorDocumentProcessor()
 void BuiltinEditorDocumentProcessor::runImpl(
         const BaseEditorDocumentParser::UpdateParams &updateParams)
 {
+    if (!m_seededFromGlobalSnapshot) {
+        m_seededFromGlobalSnapshot = true;
+        seedFromGlobalSnapshot();
+    }
+
     m_parserFuture = Utils::runAsync(CppModelManager::instance()->sharedThreadPool(),
                                      runParser,
                                      parser(),
@@ -336,4 +342,28 @@ SemanticInfo::Source BuiltinEditorDocumentProcessor::createSemanticInfoSource(bo
                                 force);
 }
 
+void BuiltinEditorDocumentProcessor::seedFromGlobalSnapshot()
+{
+    // The indexer has usually parsed the file long before it is opened in an
+    // editor. Its results are approximate - the document content might have
+    // changed and the editor defines were not applied - but showing them right
+    // away bridges the time until the first in-editor parse finishes, which
+    // then replaces them.
+    const CPlusPlus::Document::Ptr document
+            = CppModelManager::instance()->snapshot().document(filePath());
+    if (!document)
+        return;
+
+    qCDebug(log) << "seeding from global snapshot" << document->fileName();
+
+    emit ifdefedOutBlocksUpdated(revision(), toTextEditorBlocks(document->skippedBlocks()));
+
+    m_codeWarnings = toTextEditorSelections(document->diagnosticMessages(), textDocument());
+    m_codeWarningsUpdated = false;
+    emit codeWarningsUpdated(revision(),
+                             m_codeWarnings,
+                             HeaderErrorDiagnosticWidgetCreator(),
+                             TextEditor::RefactorMarkers());
+}
+
 } // namespace CppTools
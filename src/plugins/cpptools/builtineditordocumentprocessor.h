@@ -60,6 +60,7 @@ private:
                                const QList<CPlusPlus::Document::DiagnosticMessage> &codeWarnings);
 
     SemanticInfo::Source createSemanticInfoSource(bool force) const;
+    void seedFromGlobalSnapshot();
 
 private:
     BuiltinEditorDocumentParser::Ptr m_parser;
@@ -68,6 +69,7 @@ private:
     CPlusPlus::Snapshot m_documentSnapshot;
     QList<QTextEdit::ExtraSelection> m_codeWarnings;
     bool m_codeWarningsUpdated;
+    bool m_seededFromGlobalSnapshot;
 
     SemanticInfoUpdater m_semanticInfoUpdater;
     QScopedPointer<SemanticHighlighter> m_semanticHighlighter;
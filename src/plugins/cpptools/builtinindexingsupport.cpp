@@ -27,8 +27,10 @@
 
 #include "builtineditordocumentparser.h"
 #include "cppchecksymbols.h"
+#include "cpplocatordata.h"
 #include "cppmodelmanager.h"
 #include "cppprojectfile.h"
+#include "cppsnapshotcache.h"
 #include "cppsourceprocessor.h"
 #include "cpptoolsconstants.h"
 #include "cpptoolsplugin.h"
@@ -40,13 +42,18 @@
 #include <coreplugin/progressmanager/progressmanager.h>
 
 #include <cplusplus/LookupContext.h>
+#include <extensionsystem/pluginmanager.h>
 #include <utils/qtcassert.h>
 #include <utils/runextensions.h>
 #include <utils/temporarydirectory.h>
 
 #include <QCoreApplication>
 #include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
+#include <QThread>
+#include <QThreadPool>
 
 using namespace CppTools;
 using namespace CppTools::Internal;
@@ -62,6 +69,7 @@ public:
     WorkingCopy workingCopy;
     QSet<QString> sourceFiles;
     int indexerFileSizeLimitInMb = -1;
+    int indexerThreadCount = 1;
 };
 
 class WriteTaskFileForDiagnostics
@@ -186,6 +194,7 @@ void index(QFutureInterface<void> &indexingFuture,
     sourceProcessor->setFileSizeLimitInMb(params.indexerFileSizeLimitInMb);
     sourceProcessor->setHeaderPaths(params.headerPaths);
     sourceProcessor->setWorkingCopy(params.workingCopy);
+    sourceProcessor->setUsesSnapshotCache(true);
 
     QStringList sources;
     QStringList headers;
@@ -239,6 +248,144 @@ void index(QFutureInterface<void> &indexingFuture,
     }
 }
 
+// A shared pool of files to be indexed. Worker threads take the next
+// unprocessed file from it, so faster shards automatically steal work that
+// slower shards have not claimed yet.
+class IndexingQueue
+{
+public:
+    IndexingQueue(const QStringList &files) : m_files(files) {}
+
+    QString takeNext()
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_next >= m_files.size())
+            return QString();
+        return m_files.at(m_next++);
+    }
+
+private:
+    QMutex m_mutex;
+    const QStringList m_files;
+    int m_next = 0;
+};
+
+// Note: indexingFuture is passed by value on purpose; the copies share their
+// result state, so progress reported from any shard ends up in the indexing
+// future the caller observes.
+void indexShard(QFutureInterface<void> indexingFuture,
+                const QFutureInterface<void> superFuture,
+                const ParseParams params,
+                IndexingQueue *sourceQueue,
+                IndexingQueue *headerQueue,
+                QAtomicInt *processedCount,
+                int totalCount)
+{
+    QScopedPointer<CppSourceProcessor> sourceProcessor(CppModelManager::createSourceProcessor());
+    sourceProcessor->setFileSizeLimitInMb(params.indexerFileSizeLimitInMb);
+    sourceProcessor->setHeaderPaths(params.headerPaths);
+    sourceProcessor->setWorkingCopy(params.workingCopy);
+    sourceProcessor->setUsesSnapshotCache(true);
+    sourceProcessor->setTodo(params.sourceFiles);
+
+    const QString conf = CppModelManager::configurationFileName();
+
+    CppModelManager *cmm = CppModelManager::instance();
+    const ProjectPartHeaderPaths fallbackHeaderPaths = cmm->headerPaths();
+    const CPlusPlus::LanguageFeatures defaultFeatures =
+            CPlusPlus::LanguageFeatures::defaultFeatures();
+
+    bool processingHeaders = false;
+    forever {
+        if (indexingFuture.isCanceled() || superFuture.isCanceled())
+            break;
+
+        bool isSourceFile = true;
+        QString fileName = sourceQueue->takeNext();
+        if (fileName.isEmpty()) {
+            isSourceFile = false;
+            fileName = headerQueue->takeNext();
+            if (fileName.isEmpty())
+                break;
+
+            // Another shard may have pulled the header in transitively already.
+            if (cmm->snapshot().contains(fileName)) {
+                const int processed = processedCount->fetchAndAddRelaxed(1) + 1;
+                // setProgressValue() locks the shared future state, so only
+                // take that lock when an update is due. isProgressUpdateNeeded()
+                // is a lock-free time check, and parse() reports the final
+                // value once all shards are done.
+                if (indexingFuture.isProgressUpdateNeeded())
+                    indexingFuture.setProgressValue(qMin(processed, totalCount));
+                continue;
+            }
+        }
+
+        const QList<ProjectPart::Ptr> parts = cmm->projectPart(fileName);
+        const CPlusPlus::LanguageFeatures languageFeatures = parts.isEmpty()
+                ? defaultFeatures
+                : parts.first()->languageFeatures;
+        sourceProcessor->setLanguageFeatures(languageFeatures);
+
+        if (isSourceFile) {
+            (void) sourceProcessor->run(conf);
+        } else if (!processingHeaders) {
+            (void) sourceProcessor->run(conf);
+
+            processingHeaders = true;
+        }
+
+        ProjectPartHeaderPaths headerPaths = parts.isEmpty()
+                ? fallbackHeaderPaths
+                : parts.first()->headerPaths;
+        sourceProcessor->setHeaderPaths(headerPaths);
+        sourceProcessor->run(fileName);
+
+        const int processed = processedCount->fetchAndAddRelaxed(1) + 1;
+        if (indexingFuture.isProgressUpdateNeeded())
+            indexingFuture.setProgressValue(qMin(processed, totalCount));
+
+        if (isSourceFile)
+            sourceProcessor->resetEnvironment();
+    }
+}
+
+void indexParallel(QFutureInterface<void> &indexingFuture,
+                   const QFutureInterface<void> &superFuture,
+                   const ParseParams params,
+                   int threadCount)
+{
+    QStringList sources;
+    QStringList headers;
+    classifyFiles(params.sourceFiles, &headers, &sources);
+
+    {
+        // Drop stale cache entries once, before any worker starts.
+        QScopedPointer<CppSourceProcessor> cleaner(CppModelManager::createSourceProcessor());
+        foreach (const QString &file, params.sourceFiles)
+            cleaner->removeFromCache(file);
+    }
+
+    IndexingQueue sourceQueue(sources);
+    IndexingQueue headerQueue(headers);
+    QAtomicInt processedCount(0);
+    const int totalCount = sources.size() + headers.size();
+
+    // Each worker merges finished documents into the model manager's snapshot
+    // through the document callback, which serializes under the model
+    // manager's lock; no further synchronization is needed here.
+    QList<QFuture<void>> workers;
+    for (int i = 0; i < threadCount; ++i) {
+        workers.append(Utils::runAsync(QThreadPool::globalInstance(), QThread::LowestPriority,
+                                       indexShard, indexingFuture, superFuture, params,
+                                       &sourceQueue, &headerQueue,
+                                       &processedCount, totalCount));
+    }
+
+    foreach (const QFuture<void> &worker, workers)
+        const_cast<QFuture<void> &>(worker).waitForFinished();
+}
+
 void parse(QFutureInterface<void> &indexingFuture,
            const QFutureInterface<void> &superFuture,
            const ParseParams params)
@@ -249,13 +396,24 @@ void parse(QFutureInterface<void> &indexingFuture,
 
     indexingFuture.setProgressRange(0, files.size());
 
+    int threadCount = params.indexerThreadCount;
+    if (threadCount <= 0)
+        threadCount = QThread::idealThreadCount();
+    threadCount = qMin(threadCount, files.size());
+
     if (FindErrorsIndexing)
         indexFindErrors(indexingFuture, superFuture, params);
+    else if (threadCount > 1)
+        indexParallel(indexingFuture, superFuture, params, threadCount);
     else
         index(indexingFuture, superFuture, params);
 
     indexingFuture.setProgressValue(files.size());
     CppModelManager::instance()->finishedRefreshingSourceFiles(files);
+
+    // Flush newly indexed documents to disk, so the next cold start benefits
+    // even if Qt Creator does not shut down cleanly.
+    CppSnapshotCache::instance()->save();
 }
 
 class BuiltinSymbolSearcher: public SymbolSearcher
@@ -273,14 +431,6 @@ public:
 
     void runSearch(QFutureInterface<Core::SearchResultItem> &future)
     {
-        future.setProgressRange(0, m_snapshot.size());
-        future.setProgressValue(0);
-        int progress = 0;
-
-        SearchSymbols search(CppToolsPlugin::stringTable());
-        search.setSymbolsToSearchFor(m_parameters.types);
-        CPlusPlus::Snapshot::const_iterator it = m_snapshot.begin();
-
         QString findString = (m_parameters.flags & Core::FindRegularExpression
                               ? m_parameters.text : QRegularExpression::escape(m_parameters.text));
         if (m_parameters.flags & Core::FindWholeWords)
@@ -289,6 +439,25 @@ public:
                                                 ? QRegularExpression::NoPatternOption
                                                 : QRegularExpression::CaseInsensitiveOption));
         matcher.optimize();
+
+        // The locator data holds ready-made index items for every document in
+        // the snapshot, so searches for classes, functions and enums do not
+        // have to re-extract the symbols of each document. Declarations are
+        // not part of that index; those searches scan the snapshot as before.
+        CppLocatorData *locatorData = ExtensionSystem::PluginManager::getObject<CppLocatorData>();
+        if (locatorData && !(m_parameters.types & SymbolSearcher::Declarations)) {
+            runIndexedSearch(future, locatorData, matcher);
+            return;
+        }
+
+        future.setProgressRange(0, m_snapshot.size());
+        future.setProgressValue(0);
+        int progress = 0;
+
+        SearchSymbols search(CppToolsPlugin::stringTable());
+        search.setSymbolsToSearchFor(m_parameters.types);
+        CPlusPlus::Snapshot::const_iterator it = m_snapshot.begin();
+
         while (it != m_snapshot.end()) {
             if (future.isPaused())
                 future.waitForResume();
@@ -297,24 +466,8 @@ public:
             if (m_fileNames.isEmpty() || m_fileNames.contains(it.value()->fileName())) {
                 QVector<Core::SearchResultItem> resultItems;
                 auto filter = [&](const IndexItem::Ptr &info) -> IndexItem::VisitorResult {
-                    if (matcher.match(info->symbolName()).hasMatch()) {
-                        QString text = info->symbolName();
-                        QString scope = info->symbolScope();
-                        if (info->type() == IndexItem::Function) {
-                            QString name;
-                            info->unqualifiedNameAndScope(info->symbolName(), &name, &scope);
-                            text = name + info->symbolType();
-                        } else if (info->type() == IndexItem::Declaration){
-                            text = info->representDeclaration();
-                        }
-
-                        Core::SearchResultItem item;
-                        item.path = scope.split(QLatin1String("::"), QString::SkipEmptyParts);
-                        item.text = text;
-                        item.icon = info->icon();
-                        item.userData = qVariantFromValue(info);
-                        resultItems << item;
-                    }
+                    if (matcher.match(info->symbolName()).hasMatch())
+                        resultItems << toSearchResultItem(info);
 
                     return IndexItem::Recurse;
                 };
@@ -331,6 +484,67 @@ public:
     }
 
 private:
+    static Core::SearchResultItem toSearchResultItem(const IndexItem::Ptr &info)
+    {
+        QString text = info->symbolName();
+        QString scope = info->symbolScope();
+        if (info->type() == IndexItem::Function) {
+            QString name;
+            info->unqualifiedNameAndScope(info->symbolName(), &name, &scope);
+            text = name + info->symbolType();
+        } else if (info->type() == IndexItem::Declaration) {
+            text = info->representDeclaration();
+        }
+
+        Core::SearchResultItem item;
+        item.path = scope.split(QLatin1String("::"), QString::SkipEmptyParts);
+        item.text = text;
+        item.icon = info->icon();
+        item.userData = qVariantFromValue(info);
+        return item;
+    }
+
+    void runIndexedSearch(QFutureInterface<Core::SearchResultItem> &future,
+                          CppLocatorData *locatorData,
+                          const QRegularExpression &matcher)
+    {
+        int wantedTypes = 0;
+        if (m_parameters.types & SymbolSearcher::Classes)
+            wantedTypes |= IndexItem::Class;
+        if (m_parameters.types & SymbolSearcher::Functions)
+            wantedTypes |= IndexItem::Function;
+        if (m_parameters.types & SymbolSearcher::Enums)
+            wantedTypes |= IndexItem::Enum;
+
+        // Report in batches so the search result window fills up while the
+        // index is still being walked.
+        enum { ResultBatchSize = 100 };
+        QVector<Core::SearchResultItem> resultItems;
+        locatorData->filterAllFiles([&](const IndexItem::Ptr &info) -> IndexItem::VisitorResult {
+            if (future.isPaused())
+                future.waitForResume();
+            if (future.isCanceled())
+                return IndexItem::Break;
+            if (!(info->type() & wantedTypes))
+                return IndexItem::Recurse;
+            if (!m_fileNames.isEmpty() && !m_fileNames.contains(info->fileName()))
+                return IndexItem::Recurse;
+
+            if (matcher.match(info->symbolName()).hasMatch()) {
+                resultItems << toSearchResultItem(info);
+                if (resultItems.size() >= ResultBatchSize) {
+                    future.reportResults(resultItems);
+                    resultItems.clear();
+                }
+            }
+            return IndexItem::Recurse;
+        });
+        if (!resultItems.isEmpty())
+            future.reportResults(resultItems);
+        if (future.isPaused())
+            future.waitForResume();
+    }
+
     const CPlusPlus::Snapshot m_snapshot;
     const Parameters m_parameters;
     const QSet<QString> m_fileNames;
@@ -355,6 +569,7 @@ QFuture<void> BuiltinIndexingSupport::refreshSourceFiles(
 
     ParseParams params;
     params.indexerFileSizeLimitInMb = indexerFileSizeLimitInMb();
+    params.indexerThreadCount = indexerThreadCount();
     params.headerPaths = mgr->headerPaths();
     params.workingCopy = mgr->workingCopy();
     params.sourceFiles = sourceFiles;
@@ -30,8 +30,11 @@
 #include <utils/algorithm.h>
 #include <utils/qtcassert.h>
 
+#include <QCache>
 #include <QCoreApplication>
 #include <QDebug>
+#include <QMutex>
+#include <QMutexLocker>
 
 // This is for experimeting highlighting ctors/dtors as functions (instead of types).
 // Whenever this feature is considered "accepted" the switch below should be permanently
@@ -50,6 +53,72 @@ public:
     using QThread::msleep;
 };
 
+// The main document is reparsed on every semantic update, but the included
+// documents only change when one of them is replaced in the snapshot. Cache
+// the identifiers contributed by the includes per main document, so that a
+// typical re-run only visits the main document's own symbols. The cached
+// QByteArrays wrap raw identifier data; holding the Document::Ptrs keeps
+// that storage alive and also prevents a recycled allocation from matching
+// the key.
+//
+// An entry pins the Document::Ptrs of the whole include closure, which
+// would otherwise be garbage collected with the snapshot. The LRU bound
+// and the eviction on CppModelManager::aboutToRemoveFiles keep the cache
+// limited to recently highlighted documents.
+class IncludedSymbolsCache
+{
+public:
+    struct Sets {
+        QSet<QByteArray> types;
+        QSet<QByteArray> fields;
+        QSet<QByteArray> functions;
+        QSet<QByteArray> statics;
+    };
+
+    IncludedSymbolsCache()
+        : m_entries(MaxEntries)
+    {}
+
+    bool find(const QString &mainFile, const QList<Document::Ptr> &includes, Sets *sets)
+    {
+        QMutexLocker locker(&m_mutex);
+        const Entry *entry = m_entries.object(mainFile);
+        if (!entry || entry->includes != includes)
+            return false;
+        *sets = entry->sets;
+        return true;
+    }
+
+    void insert(const QString &mainFile, const QList<Document::Ptr> &includes, const Sets &sets)
+    {
+        Entry *entry = new Entry;
+        entry->includes = includes;
+        entry->sets = sets;
+        QMutexLocker locker(&m_mutex);
+        m_entries.insert(mainFile, entry);
+    }
+
+    void remove(const QStringList &files)
+    {
+        QMutexLocker locker(&m_mutex);
+        foreach (const QString &file, files)
+            m_entries.remove(file);
+    }
+
+private:
+    struct Entry {
+        QList<Document::Ptr> includes;
+        Sets sets;
+    };
+
+    enum { MaxEntries = 20 };
+
+    QMutex m_mutex;
+    QCache<QString, Entry> m_entries;
+};
+
+Q_GLOBAL_STATIC(IncludedSymbolsCache, includedSymbolsCache)
+
 class CollectSymbols: protected SymbolVisitor
 {
     Document::Ptr _doc;
@@ -58,14 +127,34 @@ class CollectSymbols: protected SymbolVisitor
     QSet<QByteArray> _fields;
     QSet<QByteArray> _functions;
     QSet<QByteArray> _statics;
-    bool _mainDocument;
 
 public:
     CollectSymbols(Document::Ptr doc, const Snapshot &snapshot)
-        : _doc(doc), _snapshot(snapshot), _mainDocument(false)
+        : _doc(doc), _snapshot(snapshot)
     {
         QSet<Namespace *> processed;
-        process(doc, &processed);
+        processed.insert(doc->globalNamespace());
+
+        QList<Document::Ptr> includes;
+        collectIncludes(doc, &processed, &includes);
+
+        IncludedSymbolsCache::Sets sets;
+        if (includedSymbolsCache()->find(doc->fileName(), includes, &sets)) {
+            _types = sets.types;
+            _fields = sets.fields;
+            _functions = sets.functions;
+            _statics = sets.statics;
+        } else {
+            foreach (const Document::Ptr &included, includes)
+                accept(included->globalNamespace());
+            sets.types = _types;
+            sets.fields = _fields;
+            sets.functions = _functions;
+            sets.statics = _statics;
+            includedSymbolsCache()->insert(doc->fileName(), includes, sets);
+        }
+
+        accept(doc->globalNamespace());
     }
 
     const QSet<QByteArray> &types() const
@@ -89,18 +178,18 @@ public:
     }
 
 protected:
-    void process(Document::Ptr doc, QSet<Namespace *> *processed)
+    void collectIncludes(Document::Ptr doc, QSet<Namespace *> *processed,
+                         QList<Document::Ptr> *includes)
     {
         if (!doc)
             return;
-        if (!processed->contains(doc->globalNamespace())) {
-            processed->insert(doc->globalNamespace());
-
-            foreach (const Document::Include &i, doc->resolvedIncludes())
-                process(_snapshot.document(i.resolvedFileName()), processed);
-
-            _mainDocument = (doc == _doc); // ### improve
-            accept(doc->globalNamespace());
+        foreach (const Document::Include &i, doc->resolvedIncludes()) {
+            Document::Ptr included = _snapshot.document(i.resolvedFileName());
+            if (!included || processed->contains(included->globalNamespace()))
+                continue;
+            processed->insert(included->globalNamespace());
+            collectIncludes(included, processed, includes);
+            includes->append(included);
         }
     }
 
@@ -310,6 +399,11 @@ CheckSymbols * CheckSymbols::create(Document::Ptr doc, const LookupContext &cont
     return new CheckSymbols(doc, context, macroUses);
 }
 
+void CheckSymbols::evictCachedSymbols(const QStringList &files)
+{
+    includedSymbolsCache()->remove(files);
+}
+
 CheckSymbols::CheckSymbols(Document::Ptr doc, const LookupContext &context, const QList<CheckSymbols::Result> &macroUses)
     : ASTVisitor(doc->translationUnit()), _doc(doc), _context(context)
     , _lineOfLastUsage(0), _macroUses(macroUses)
@@ -70,6 +70,9 @@ public:
                                  const CPlusPlus::LookupContext &context,
                                  const QList<Result> &macroUses);
 
+    // Drops the cached included-document symbols for the given files.
+    static void evictCachedSymbols(const QStringList &files);
+
     static QMap<int, QVector<Result> > chunks(const QFuture<Result> &future, int from, int to)
     {
         QMap<int, QVector<Result> > chunks;
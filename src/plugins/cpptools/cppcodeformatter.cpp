@@ -605,6 +605,7 @@ void CodeFormatter::indentForNewLineAfter(const QTextBlock &block, int *indent,
     int lexerState = loadLexerState(block);
     m_tokens.clear();
     m_currentLine.clear();
+    m_tokenizeStartState = -1;
     adjustIndent(m_tokens, lexerState, indent, padding);
 }
 
@@ -1050,6 +1051,21 @@ int CodeFormatter::tokenizeBlock(const QTextBlock &block, bool *endedJoined)
         startState = 0;
     QTC_ASSERT(startState != -1, return 0);
 
+    QString text = block.text();
+    // to determine whether a line was joined, Tokenizer needs a
+    // newline character at the end
+    text.append(QLatin1Char('\n'));
+
+    // Reindenting lexes each line twice, once for the indentation and once
+    // for the state recalculation after the line was changed - which often
+    // didn't happen. Identical input produces identical tokens.
+    if (startState == m_tokenizeStartState && text == m_currentLine) {
+        if (endedJoined)
+            *endedJoined = m_tokenizeEndedJoined;
+        TextDocumentLayout::setLexerState(block, m_tokenizeEndState);
+        return m_tokenizeEndState;
+    }
+
     LanguageFeatures features;
     features.qtEnabled = true;
     features.qtMocRunEnabled = true;
@@ -1060,18 +1076,17 @@ int CodeFormatter::tokenizeBlock(const QTextBlock &block, bool *endedJoined)
     SimpleLexer tokenize;
     tokenize.setLanguageFeatures(features);
 
-    m_currentLine = block.text();
-    // to determine whether a line was joined, Tokenizer needs a
-    // newline character at the end
-    m_currentLine.append(QLatin1Char('\n'));
+    m_currentLine = text;
+    m_tokenizeStartState = startState;
     m_tokens = tokenize(m_currentLine, startState);
+    m_tokenizeEndedJoined = tokenize.endedJoined();
+    m_tokenizeEndState = tokenize.state();
 
     if (endedJoined)
-        *endedJoined = tokenize.endedJoined();
+        *endedJoined = m_tokenizeEndedJoined;
 
-    const int lexerState = tokenize.state();
-    TextDocumentLayout::setLexerState(block, lexerState);
-    return lexerState;
+    TextDocumentLayout::setLexerState(block, m_tokenizeEndState);
+    return m_tokenizeEndState;
 }
 
 void CodeFormatter::dump() const
@@ -241,6 +241,11 @@ private:
     CPlusPlus::Token m_currentToken;
     int m_tokenIndex = 0;
 
+    // for reusing the tokens of the last tokenizeBlock() call
+    int m_tokenizeStartState = -1;
+    int m_tokenizeEndState = 0;
+    bool m_tokenizeEndedJoined = false;
+
     int m_indentDepth = 0;
     int m_paddingDepth = 0;
 
@@ -67,6 +67,9 @@ static QString skipIndexingBigFilesKey()
 static QString indexerFileSizeLimitKey()
 { return QLatin1String(Constants::CPPTOOLS_INDEXER_FILE_SIZE_LIMIT); }
 
+static QString indexerThreadCountKey()
+{ return QLatin1String(Constants::CPPTOOLS_INDEXER_THREAD_COUNT); }
+
 void CppCodeModelSettings::fromSettings(QSettings *s)
 {
     s->beginGroup(QLatin1String(Constants::CPPTOOLS_SETTINGSGROUP));
@@ -101,6 +104,9 @@ void CppCodeModelSettings::fromSettings(QSettings *s)
     const QVariant indexerFileSizeLimit = s->value(indexerFileSizeLimitKey(), 5);
     setIndexerFileSizeLimitInMb(indexerFileSizeLimit.toInt());
 
+    const QVariant indexerThreadCount = s->value(indexerThreadCountKey(), 0);
+    setIndexerThreadCount(indexerThreadCount.toInt());
+
     s->endGroup();
 
     emit changed();
@@ -127,6 +133,7 @@ void CppCodeModelSettings::toSettings(QSettings *s)
     s->setValue(interpretAmbiguousHeadersAsCHeadersKey(), interpretAmbigiousHeadersAsCHeaders());
     s->setValue(skipIndexingBigFilesKey(), skipIndexingBigFiles());
     s->setValue(indexerFileSizeLimitKey(), indexerFileSizeLimitInMb());
+    s->setValue(indexerThreadCountKey(), indexerThreadCount());
 
     s->endGroup();
 
@@ -195,6 +202,16 @@ void CppCodeModelSettings::setSkipIndexingBigFiles(bool yesno)
     m_skipIndexingBigFiles = yesno;
 }
 
+int CppCodeModelSettings::indexerThreadCount() const
+{
+    return m_indexerThreadCount;
+}
+
+void CppCodeModelSettings::setIndexerThreadCount(int threadCount)
+{
+    m_indexerThreadCount = threadCount;
+}
+
 int CppCodeModelSettings::indexerFileSizeLimitInMb() const
 {
     return m_indexerFileSizeLimitInMB;
@@ -72,6 +72,9 @@ public:
     int indexerFileSizeLimitInMb() const;
     void setIndexerFileSizeLimitInMb(int sizeInMB);
 
+    int indexerThreadCount() const;
+    void setIndexerThreadCount(int threadCount);
+
 public: // for tests
     void emitChanged();
 
@@ -84,6 +87,7 @@ private:
     bool m_interpretAmbigiousHeadersAsCHeaders = false;
     bool m_skipIndexingBigFiles = true;
     int m_indexerFileSizeLimitInMB = 5;
+    int m_indexerThreadCount = 0; // 0 == automatic
     ClangDiagnosticConfigs m_clangCustomDiagnosticConfigs;
     Core::Id m_clangDiagnosticConfigId;
 };
@@ -214,12 +214,19 @@ public:
             doc->tokenize();
         }
 
+        if (future->isCanceled())
+            return usages;
+
         Control *control = doc->control();
         if (control->findIdentifier(symbolId->chars(), symbolId->size()) != 0) {
             if (doc != symbolDocument)
                 doc->check();
 
+            if (future->isCanceled())
+                return usages;
+
             FindUsages process(unpreprocessedSource, doc, snapshot);
+            process.setCancelChecker([this]() { return future->isCanceled(); });
             process(symbol);
 
             usages = process.usages();
@@ -300,7 +307,16 @@ static void find_helper(QFutureInterface<Usage> &future,
                 files.append(i.key());
         }
     } else {
-        files += snapshot.filesDependingOn(sourceFile);
+        // Consult the dependency table for candidates, but drop the ones whose
+        // identifier table does not even mention the symbol. This keeps the
+        // progress range honest and avoids dispatching no-op items to the pool.
+        foreach (const Utils::FileName &fileName, snapshot.filesDependingOn(sourceFile)) {
+            if (Document::Ptr doc = snapshot.document(fileName)) {
+                if (!doc->control()->findIdentifier(symbolId->chars(), symbolId->size()))
+                    continue;
+            }
+            files.append(fileName);
+        }
     }
     files = Utils::filteredUnique(files);
 
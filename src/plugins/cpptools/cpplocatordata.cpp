@@ -44,6 +44,8 @@ CppLocatorData::CppLocatorData()
 
 void CppLocatorData::onDocumentUpdated(const CPlusPlus::Document::Ptr &document)
 {
+    m_version.ref();
+
     QMutexLocker locker(&m_pendingDocumentsMutex);
 
     int i = 0, ei = m_pendingDocuments.size();
@@ -66,6 +68,8 @@ void CppLocatorData::onAboutToRemoveFiles(const QStringList &files)
     if (files.isEmpty())
         return;
 
+    m_version.ref();
+
     QMutexLocker locker(&m_pendingDocumentsMutex);
 
     foreach (const QString &file, files) {
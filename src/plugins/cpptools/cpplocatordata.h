@@ -50,6 +50,10 @@ class CppLocatorData : public QObject
     friend class Internal::CppToolsPlugin;
 
 public:
+    // Incremented whenever a document is scheduled for (re)indexing or
+    // removed; lets clients detect that cached query results are stale.
+    int version() const { return m_version.load(); }
+
     void filterAllFiles(IndexItem::Visitor func) const
     {
         flushPendingDocument(true);
@@ -78,6 +82,8 @@ private:
     mutable SearchSymbols m_search;
     mutable QHash<QString, IndexItem::Ptr> m_infosByFile;
 
+    QAtomicInt m_version;
+
     mutable QMutex m_pendingDocumentsMutex;
     mutable QVector<CPlusPlus::Document::Ptr> m_pendingDocuments;
 };
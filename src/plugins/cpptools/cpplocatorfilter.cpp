@@ -29,6 +29,7 @@
 #include <coreplugin/editormanager/editormanager.h>
 #include <utils/algorithm.h>
 
+#include <QMutexLocker>
 #include <QRegExp>
 #include <QStringMatcher>
 
@@ -67,6 +68,13 @@ void CppLocatorFilter::refresh(QFutureInterface<void> &future)
     Q_UNUSED(future)
 }
 
+void CppLocatorFilter::prepareSearch(const QString &entry)
+{
+    Q_UNUSED(entry)
+    QMutexLocker locker(&m_cacheMutex);
+    m_current = m_cache;
+}
+
 QList<Core::LocatorFilterEntry> CppLocatorFilter::matchesFor(
         QFutureInterface<Core::LocatorFilterEntry> &future, const QString &entry)
 {
@@ -81,41 +89,87 @@ QList<Core::LocatorFilterEntry> CppLocatorFilter::matchesFor(
     bool hasColonColon = entry.contains(QLatin1String("::"));
     const IndexItem::ItemType wanted = matchTypes();
 
-    m_data->filterAllFiles([&](const IndexItem::Ptr &info) -> IndexItem::VisitorResult {
-        if (future.isCanceled())
-            return IndexItem::Break;
-        if (info->type() & wanted) {
-            const QString matchString = hasColonColon ? info->scopedSymbolName() : info->symbolName();
-            int index = hasWildcard ? regexp.indexIn(matchString) : matcher.indexIn(matchString);
-            if (index >= 0) {
-                const bool betterMatch = index == 0;
-                Core::LocatorFilterEntry filterEntry = filterEntryFromIndexItem(info);
-
-                if (matchString != filterEntry.displayName) {
-                    index = hasWildcard ? regexp.indexIn(filterEntry.displayName)
-                                        : matcher.indexIn(filterEntry.displayName);
-                }
-
-                if (index >= 0)
-                    filterEntry.highlightInfo = {index, (hasWildcard ? regexp.matchedLength() : entry.length())};
-
-                if (betterMatch)
-                    betterEntries.append(filterEntry);
-                else
-                    goodEntries.append(filterEntry);
+    // A query that extends the previous one can only match a subset of the
+    // previous matches, so re-rank those instead of walking the whole index.
+    // Not applicable if "::" was added (the matched string changes from the
+    // symbol name to the scoped name) or if the index changed in the meantime.
+    const bool refineFromPreviousMatches = !hasWildcard
+            && !m_current.previousEntry.isEmpty()
+            && entry.contains(m_current.previousEntry)
+            && !(hasColonColon && !m_current.previousEntry.contains(QLatin1String("::")))
+            && m_current.dataVersion == m_data->version();
+
+    QList<IndexItem::Ptr> matches;
+    const auto matchItem = [&](const IndexItem::Ptr &info) {
+        const QString matchString = hasColonColon ? info->scopedSymbolName() : info->symbolName();
+        int index = hasWildcard ? regexp.indexIn(matchString) : matcher.indexIn(matchString);
+        if (index >= 0) {
+            const bool betterMatch = index == 0;
+            Core::LocatorFilterEntry filterEntry = filterEntryFromIndexItem(info);
+
+            if (matchString != filterEntry.displayName) {
+                index = hasWildcard ? regexp.indexIn(filterEntry.displayName)
+                                    : matcher.indexIn(filterEntry.displayName);
             }
-        }
 
-        if (info->type() & IndexItem::Enum)
-            return IndexItem::Continue;
-        else
-            return IndexItem::Recurse;
-    });
+            if (index >= 0)
+                filterEntry.highlightInfo = {index, (hasWildcard ? regexp.matchedLength() : entry.length())};
 
-    if (goodEntries.size() < 1000)
+            if (betterMatch)
+                betterEntries.append(filterEntry);
+            else
+                goodEntries.append(filterEntry);
+            matches.append(info);
+        }
+    };
+
+    if (refineFromPreviousMatches) {
+        foreach (const IndexItem::Ptr &info, m_current.previousMatches) {
+            if (future.isCanceled())
+                break;
+            matchItem(info);
+        }
+    } else {
+        m_data->filterAllFiles([&](const IndexItem::Ptr &info) -> IndexItem::VisitorResult {
+            if (future.isCanceled())
+                return IndexItem::Break;
+            if (info->type() & wanted)
+                matchItem(info);
+
+            if (info->type() & IndexItem::Enum)
+                return IndexItem::Continue;
+            else
+                return IndexItem::Recurse;
+        });
+    }
+
+    // Canceled searches are not published: their match list is incomplete,
+    // and the cache keeps the last completed search, whose matches are a
+    // superset for any extending query.
+    if (!future.isCanceled()) {
+        m_current.previousEntry = entry;
+        m_current.previousMatches = matches;
+        m_current.dataVersion = m_data->version();
+        QMutexLocker locker(&m_cacheMutex);
+        m_cache = m_current;
+    }
+
+    // Fully sorting a huge match list is not worth it; for those, just bring
+    // the lexicographically first entries to the front, which is far more
+    // than the locator popup can usefully show anyway.
+    const int maxFullSort = 1000;
+    if (goodEntries.size() < maxFullSort) {
         Utils::sort(goodEntries, Core::LocatorFilterEntry::compareLexigraphically);
-    if (betterEntries.size() < 1000)
+    } else {
+        std::partial_sort(goodEntries.begin(), goodEntries.begin() + maxFullSort,
+                          goodEntries.end(), Core::LocatorFilterEntry::compareLexigraphically);
+    }
+    if (betterEntries.size() < maxFullSort) {
         Utils::sort(betterEntries, Core::LocatorFilterEntry::compareLexigraphically);
+    } else {
+        std::partial_sort(betterEntries.begin(), betterEntries.begin() + maxFullSort,
+                          betterEntries.end(), Core::LocatorFilterEntry::compareLexigraphically);
+    }
 
     betterEntries += goodEntries;
     return betterEntries;
@@ -30,6 +30,8 @@
 
 #include <coreplugin/locator/ilocatorfilter.h>
 
+#include <QMutex>
+
 namespace CppTools {
 namespace Internal {
 
@@ -41,6 +43,7 @@ public:
     CppLocatorFilter(CppLocatorData *locatorData);
     ~CppLocatorFilter();
 
+    void prepareSearch(const QString &entry) override;
     QList<Core::LocatorFilterEntry> matchesFor(QFutureInterface<Core::LocatorFilterEntry> &future,
                                                const QString &entry) override;
     void accept(Core::LocatorFilterEntry selection,
@@ -53,6 +56,24 @@ protected:
 
 protected:
     CppLocatorData *m_data;
+
+private:
+    // Matches of the last completed search. When the next query merely
+    // extends the previous one, only these items are re-checked instead of
+    // walking the whole index again.
+    struct MatchCache
+    {
+        QString previousEntry;
+        QList<IndexItem::Ptr> previousMatches;
+        int dataVersion = -1;
+    };
+
+    // The handoff crosses threads: matchesFor() publishes into m_cache on
+    // the worker thread and prepareSearch() copies it out on the GUI
+    // thread, so both only touch m_cache with m_cacheMutex held.
+    mutable QMutex m_cacheMutex;
+    MatchCache m_cache;
+    MatchCache m_current; // state of the currently running search
 };
 
 } // namespace Internal
@@ -145,6 +145,11 @@ public:
     QMap<QString, CppEditorDocumentHandle *> m_cppEditorDocuments;
     QSet<AbstractEditorSupport *> m_extraEditorSupports;
 
+    // Coalesced refresh of non-focused visible editor documents;
+    // maps file path to the projectsUpdated flag of the pending run.
+    QTimer m_deferredEditorUpdateTimer;
+    QHash<QString, bool> m_deferredEditorUpdates;
+
     // Model Manager Supports for e.g. completion and highlighting
     ModelManagerSupport::Ptr m_builtinModelManagerSupport;
     ModelManagerSupport::Ptr m_activeModelManagerSupport;
@@ -338,6 +343,15 @@ CppModelManager::CppModelManager(QObject *parent)
     d->m_delayedGcTimer.setSingleShot(true);
     connect(&d->m_delayedGcTimer, &QTimer::timeout, this, &CppModelManager::GC);
 
+    d->m_deferredEditorUpdateTimer.setObjectName(
+                QLatin1String("CppModelManager::m_deferredEditorUpdateTimer"));
+    d->m_deferredEditorUpdateTimer.setSingleShot(true);
+    bool ok = false;
+    const int coalesceInterval = qgetenv("QTC_EDITOR_UPDATE_COALESCE_MS").toInt(&ok);
+    d->m_deferredEditorUpdateTimer.setInterval(ok ? coalesceInterval : 250);
+    connect(&d->m_deferredEditorUpdateTimer, &QTimer::timeout,
+            this, &CppModelManager::processDeferredCppEditorDocumentUpdates);
+
     auto sessionManager = ProjectExplorer::SessionManager::instance();
     connect(sessionManager, &ProjectExplorer::SessionManager::projectAdded,
             this, &CppModelManager::onProjectAdded);
@@ -483,15 +497,29 @@ QByteArray CppModelManager::internalDefinedMacros() const
 /// This function will acquire mutexes!
 void CppModelManager::dumpModelManagerConfiguration(const QString &logFileId)
 {
+    // Tooling that parses the dump usually needs only some of the sections.
+    // They can be selected with QTC_DUMP_PROJECT_INFO_SECTIONS, e.g.
+    // "projects,snapshot"; an unset or empty variable dumps everything. The
+    // section names are: projects, snapshot, workingcopy, merged.
+    const QByteArray dumpSectionsValue = qgetenv("QTC_DUMP_PROJECT_INFO_SECTIONS");
+    const QList<QByteArray> dumpSections = dumpSectionsValue.split(',');
+    const auto isSectionEnabled = [&](const char *section) {
+        return dumpSectionsValue.isEmpty() || dumpSections.contains(QByteArray(section));
+    };
+
     const Snapshot globalSnapshot = snapshot();
     const QString globalSnapshotTitle
         = QString::fromLatin1("Global/Indexing Snapshot (%1 Documents)").arg(globalSnapshot.size());
 
     CppCodeModelInspector::Dumper dumper(globalSnapshot, logFileId);
-    dumper.dumpProjectInfos(projectInfos());
-    dumper.dumpSnapshot(globalSnapshot, globalSnapshotTitle, /*isGlobalSnapshot=*/ true);
-    dumper.dumpWorkingCopy(workingCopy());
-    dumper.dumpMergedEntities(headerPaths(), definedMacros());
+    if (isSectionEnabled("projects"))
+        dumper.dumpProjectInfos(projectInfos());
+    if (isSectionEnabled("snapshot"))
+        dumper.dumpSnapshot(globalSnapshot, globalSnapshotTitle, /*isGlobalSnapshot=*/ true);
+    if (isSectionEnabled("workingcopy"))
+        dumper.dumpWorkingCopy(workingCopy());
+    if (isSectionEnabled("merged"))
+        dumper.dumpMergedEntities(headerPaths(), definedMacros());
 }
 
 QSet<AbstractEditorSupport *> CppModelManager::abstractEditorSupports() const
@@ -817,18 +845,31 @@ void CppModelManager::watchForCanceledProjectIndexer(const QVector<QFuture<void>
 
 void CppModelManager::updateCppEditorDocuments(bool projectsUpdated) const
 {
-    // Refresh visible documents
+    // Refresh the focused document right away. The other visible documents
+    // are queued and caught up after a short quiet period, so that a burst of
+    // invalidations - typically from editing a widely included header - does
+    // not freeze typing while every dependent editor re-parses at once.
+    Core::IDocument *currentDocument = Core::EditorManager::currentDocument();
     QSet<Core::IDocument *> visibleCppEditorDocuments;
     foreach (Core::IEditor *editor, Core::EditorManager::visibleEditors()) {
         if (Core::IDocument *document = editor->document()) {
             const QString filePath = document->filePath().toString();
             if (CppEditorDocumentHandle *theCppEditorDocument = cppEditorDocument(filePath)) {
                 visibleCppEditorDocuments.insert(document);
-                theCppEditorDocument->processor()->run(projectsUpdated);
+                if (document == currentDocument) {
+                    d->m_deferredEditorUpdates.remove(filePath);
+                    theCppEditorDocument->processor()->run(projectsUpdated);
+                } else {
+                    d->m_deferredEditorUpdates[filePath] =
+                            d->m_deferredEditorUpdates.value(filePath) || projectsUpdated;
+                }
             }
         }
     }
 
+    if (!d->m_deferredEditorUpdates.isEmpty())
+        d->m_deferredEditorUpdateTimer.start();
+
     // Mark invisible documents dirty
     QSet<Core::IDocument *> invisibleCppEditorDocuments
         = Core::DocumentModel::openedDocuments().toSet();
@@ -844,6 +885,33 @@ void CppModelManager::updateCppEditorDocuments(bool projectsUpdated) const
     }
 }
 
+void CppModelManager::processDeferredCppEditorDocumentUpdates()
+{
+    const QHash<QString, bool> deferredUpdates = d->m_deferredEditorUpdates;
+    d->m_deferredEditorUpdates.clear();
+
+    QSet<QString> visibleFilePaths;
+    foreach (Core::IEditor *editor, Core::EditorManager::visibleEditors()) {
+        if (Core::IDocument *document = editor->document())
+            visibleFilePaths.insert(document->filePath().toString());
+    }
+
+    QHash<QString, bool>::ConstIterator it = deferredUpdates.constBegin();
+    for (; it != deferredUpdates.constEnd(); ++it) {
+        CppEditorDocumentHandle *theCppEditorDocument = cppEditorDocument(it.key());
+        if (!theCppEditorDocument)
+            continue;
+        if (visibleFilePaths.contains(it.key())) {
+            theCppEditorDocument->processor()->run(it.value());
+        } else {
+            // The document went out of sight in the meantime; catch up on focus.
+            theCppEditorDocument->setRefreshReason(it.value()
+                    ? CppEditorDocumentHandle::ProjectUpdate
+                    : CppEditorDocumentHandle::Other);
+        }
+    }
+}
+
 QFuture<void> CppModelManager::updateProjectInfo(const ProjectInfo &newProjectInfo)
 {
     QFutureInterface<void> dummy;
@@ -1105,6 +1173,11 @@ void CppModelManager::onCurrentEditorChanged(Core::IEditor *editor)
 
     const QString filePath = editor->document()->filePath().toString();
     if (CppEditorDocumentHandle *theCppEditorDocument = cppEditorDocument(filePath)) {
+        if (d->m_deferredEditorUpdates.contains(filePath)) {
+            // Don't let the newly focused editor wait for the coalescing timer.
+            theCppEditorDocument->processor()->run(d->m_deferredEditorUpdates.take(filePath));
+            return;
+        }
         const CppEditorDocumentHandle::RefreshReason refreshReason
                 = theCppEditorDocument->refreshReason();
         if (refreshReason != CppEditorDocumentHandle::None) {
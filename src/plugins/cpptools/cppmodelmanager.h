@@ -216,6 +216,7 @@ private:
 
     void initializeBuiltinModelManagerSupport();
     void delayedGC();
+    void processDeferredCppEditorDocumentUpdates();
     void recalculateProjectPartMappings();
     void watchForCanceledProjectIndexer(const QVector<QFuture<void> > &futures,
                                         ProjectExplorer::Project *project);
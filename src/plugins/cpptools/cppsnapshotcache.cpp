@@ -0,0 +1,441 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt Creator.
+**
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+****************************************************************************/
+
+#include "cppsnapshotcache.h"
+
+#include "cppmodelmanager.h"
+
+#include <coreplugin/icore.h>
+
+#include <cplusplus/PreprocessorEnvironment.h>
+#include <cplusplus/pp-engine.h>
+
+#include <utils/fileutils.h>
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+/*!
+    \class CppTools::Internal::CppSnapshotCache
+
+    \brief A persistent cache of preprocessed documents that lets a cold start
+           skip the preprocessor for files that did not change on disk.
+
+    For every indexed file the cache stores the preprocessed source together
+    with the document's include list and defined macros. On the next start a
+    file whose modification time and size still match its cache entry is
+    reconstructed from the stored preprocessor output and only re-parsed;
+    include resolution and macro expansion - the expensive part of a full
+    reindex - are skipped entirely. Entries are invalidated wholesale when the
+    configured defines or header paths change.
+
+    The cache is loaded lazily on first use and written back after indexing
+    runs and on shutdown. All public functions are thread-safe, since the
+    indexer may run several source processors in parallel.
+*/
+
+using namespace CPlusPlus;
+using namespace CppTools;
+using namespace CppTools::Internal;
+
+static const bool CacheDisabled = qEnvironmentVariableIsSet("QTC_NO_CPP_SNAPSHOT_CACHE");
+
+enum {
+    cacheMagic = 0x43505053, // "CPPS"
+    cacheVersion = 1,
+    maxCachedSourceSize = 8 * 1024 * 1024
+};
+
+namespace CppTools {
+namespace Internal {
+
+QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::MacroData &macro)
+{
+    out << macro.name << macro.formals << macro.definitionText << macro.fileName
+        << macro.line << macro.bytesOffset << macro.utf16charsOffset
+        << macro.hidden << macro.functionLike << macro.variadic;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, CppSnapshotCache::MacroData &macro)
+{
+    in >> macro.name >> macro.formals >> macro.definitionText >> macro.fileName
+       >> macro.line >> macro.bytesOffset >> macro.utf16charsOffset
+       >> macro.hidden >> macro.functionLike >> macro.variadic;
+    return in;
+}
+
+QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::IncludeData &include)
+{
+    out << include.unresolvedFileName << include.resolvedFileName << include.line << include.type;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, CppSnapshotCache::IncludeData &include)
+{
+    in >> include.unresolvedFileName >> include.resolvedFileName >> include.line >> include.type;
+    return in;
+}
+
+QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::Entry &entry)
+{
+    out << entry.lastModified << entry.fileSize << entry.languageFeatures
+        << entry.fingerprint << entry.compressedSource << entry.includes << entry.macros;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, CppSnapshotCache::Entry &entry)
+{
+    in >> entry.lastModified >> entry.fileSize >> entry.languageFeatures
+       >> entry.fingerprint >> entry.compressedSource >> entry.includes >> entry.macros;
+    return in;
+}
+
+} // namespace Internal
+} // namespace CppTools
+
+static Macro templateMacro(const CppSnapshotCache::MacroData &data)
+{
+    Macro macro;
+    macro.setName(data.name);
+    foreach (const QByteArray &formal, data.formals)
+        macro.addFormal(formal);
+    macro.setDefinition(data.definitionText, QVector<Macro::PPToken>());
+    macro.setFileName(data.fileName);
+    macro.setLine(data.line);
+    macro.setBytesOffset(data.bytesOffset);
+    macro.setUtf16charOffset(data.utf16charsOffset);
+    macro.setHidden(data.hidden);
+    macro.setFunctionLike(data.functionLike);
+    macro.setVariadic(data.variadic);
+    return macro;
+}
+
+// Serialized macros lack their definition tokens, which the preprocessor needs
+// for expansion when the restored document is merged into an environment.
+// Rebuild them by feeding the stored definitions through a throw-away
+// preprocessor run and harvesting the fully set up macros from its
+// environment.
+static void restoreMacros(Document::Ptr document, const QList<CppSnapshotCache::MacroData> &macros)
+{
+    if (macros.isEmpty())
+        return;
+
+    QByteArray defines;
+    QList<int> definedIndexes;
+    for (int i = 0; i < macros.size(); ++i) {
+        const CppSnapshotCache::MacroData &data = macros.at(i);
+        if (data.hidden)
+            continue; // Hidden macros are never expanded; metadata is enough.
+        defines += templateMacro(data).toString().toUtf8();
+        defines += '\n';
+        definedIndexes.append(i);
+    }
+
+    Environment env;
+    Preprocessor preprocessor(0, &env);
+    preprocessor.run(QLatin1String("<snapshot cache>"), defines);
+
+    QHash<int, const Macro *> restored;
+    if (int(env.macroCount()) == definedIndexes.size()) {
+        for (unsigned i = 0; i < env.macroCount(); ++i) {
+            const Macro *macro = env.macroAt(i);
+            const int index = definedIndexes.at(int(i));
+            if (macro->name() == macros.at(index).name)
+                restored.insert(index, macro);
+        }
+    }
+
+    for (int i = 0; i < macros.size(); ++i) {
+        const CppSnapshotCache::MacroData &data = macros.at(i);
+        if (const Macro *envMacro = restored.value(i)) {
+            Macro macro = *envMacro;
+            macro.setFileName(data.fileName);
+            macro.setLine(data.line);
+            macro.setBytesOffset(data.bytesOffset);
+            macro.setUtf16charOffset(data.utf16charsOffset);
+            document->appendMacro(macro);
+        } else {
+            document->appendMacro(templateMacro(data));
+        }
+    }
+}
+
+CppSnapshotCache *CppSnapshotCache::instance()
+{
+    static CppSnapshotCache cache;
+    return &cache;
+}
+
+CppSnapshotCache::CppSnapshotCache()
+{
+}
+
+QString CppSnapshotCache::cacheFilePath()
+{
+    return Core::ICore::userResourcePath() + QLatin1String("/codemodel/snapshot.cache");
+}
+
+// Changed defines or header paths make every cached preprocessor run stale,
+// so the whole cache is keyed on a fingerprint of the configuration.
+QByteArray CppSnapshotCache::configurationFingerprint() const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    CppModelManager *cmm = CppModelManager::instance();
+    hash.addData(cmm->definedMacros());
+    foreach (const ProjectPartHeaderPath &headerPath, cmm->headerPaths()) {
+        hash.addData(headerPath.path.toUtf8());
+        hash.addData(reinterpret_cast<const char *>(&headerPath.type), sizeof(headerPath.type));
+    }
+    return hash.result();
+}
+
+void CppSnapshotCache::ensureLoaded()
+{
+    if (m_loaded)
+        return;
+    m_loaded = true;
+
+    m_configuration = configurationFingerprint();
+    if (!loadFile(cacheFilePath()))
+        m_entries.clear();
+}
+
+// The defines and header paths can change mid-session - a kit switch, an
+// edit to the project settings - and the reindex such a change triggers is
+// exactly what this cache intercepts: file modification times are unchanged,
+// so every entry would restore preprocessor output produced under the old
+// configuration. Recheck the fingerprint on every cache access and drop the
+// entries when it moved. Must be called with m_mutex held, after
+// ensureLoaded().
+void CppSnapshotCache::checkConfiguration()
+{
+    const QByteArray fingerprint = configurationFingerprint();
+    if (fingerprint == m_configuration)
+        return;
+    if (!m_entries.isEmpty()) {
+        m_entries.clear();
+        m_dirty = true;
+    }
+    m_configuration = fingerprint;
+}
+
+bool CppSnapshotCache::loadFile(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray configuration;
+    in >> magic >> version >> configuration;
+    if (magic != quint32(cacheMagic) || version != quint32(cacheVersion))
+        return false;
+    if (configuration != m_configuration)
+        return false;
+
+    in >> m_entries;
+    return in.status() == QDataStream::Ok;
+}
+
+void CppSnapshotCache::save()
+{
+    if (CacheDisabled)
+        return;
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_loaded || !m_dirty)
+        return;
+
+    const QString filePath = cacheFilePath();
+    if (!QDir().mkpath(QFileInfo(filePath).absolutePath()))
+        return;
+
+    Utils::FileSaver saver(filePath);
+    {
+        QDataStream out(saver.file());
+        out.setVersion(QDataStream::Qt_5_6);
+        // Stamp the entries with the fingerprint they were produced under,
+        // not with the current one: the configuration may have changed since
+        // the last restore or remember recorded it.
+        out << quint32(cacheMagic) << quint32(cacheVersion) << m_configuration;
+        out << m_entries;
+        saver.setResult(&out);
+    }
+    if (saver.finalize())
+        m_dirty = false;
+}
+
+void CppSnapshotCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_dirty = true;
+}
+
+// An entry's preprocessed source bakes in the macro expansions of its
+// includes, so matching the file's own modification time and size is not
+// enough: a header changed while the cache sat on disk would restore stale
+// expansions into every unchanged dependent. Walk the stored include lists
+// and validate the whole closure against the file system; a file whose
+// sub-closure cannot be vouched for - no cache entry, or a mismatch - fails
+// the restore, which then falls through to a real preprocessor run. Files in
+// the working copy fail as well: the caller would preprocess them from the
+// editor buffer, whose contents the on-disk entry knows nothing about.
+// \a validated memoizes checked files and breaks include cycles. Must be
+// called with m_mutex held.
+bool CppSnapshotCache::isEntryValid(const QString &filePath, const WorkingCopy &workingCopy,
+                                    QSet<QString> *validated) const
+{
+    if (validated->contains(filePath))
+        return true;
+    if (workingCopy.contains(filePath))
+        return false;
+    validated->insert(filePath);
+
+    const QHash<QString, Entry>::ConstIterator it = m_entries.constFind(filePath);
+    if (it == m_entries.constEnd())
+        return false;
+
+    const Entry &entry = it.value();
+    const QFileInfo info(filePath);
+    if (!info.exists()
+            || info.lastModified() != entry.lastModified
+            || info.size() != entry.fileSize) {
+        return false;
+    }
+
+    foreach (const IncludeData &include, entry.includes) {
+        if (include.resolvedFileName.isEmpty())
+            continue; // Unresolved at cache time; contributed nothing.
+        if (!isEntryValid(include.resolvedFileName, workingCopy, validated))
+            return false;
+    }
+    return true;
+}
+
+Document::Ptr CppSnapshotCache::restoreDocument(const QString &filePath,
+                                                LanguageFeatures languageFeatures,
+                                                const WorkingCopy &workingCopy)
+{
+    if (CacheDisabled)
+        return Document::Ptr();
+
+    Entry entry;
+    {
+        QMutexLocker locker(&m_mutex);
+        ensureLoaded();
+        checkConfiguration();
+        const QHash<QString, Entry>::ConstIterator it = m_entries.constFind(filePath);
+        if (it == m_entries.constEnd())
+            return Document::Ptr();
+        entry = it.value();
+
+        QSet<QString> validated;
+        if (!isEntryValid(filePath, workingCopy, &validated))
+            return Document::Ptr();
+    }
+
+    if (entry.languageFeatures != languageFeatures.flags)
+        return Document::Ptr();
+
+    Document::Ptr document = Document::create(filePath);
+    document->setLastModified(entry.lastModified);
+    document->setLanguageFeatures(languageFeatures);
+    document->setFingerprint(entry.fingerprint);
+
+    foreach (const IncludeData &include, entry.includes) {
+        document->addIncludeFile(Document::Include(include.unresolvedFileName,
+                                                   include.resolvedFileName,
+                                                   include.line,
+                                                   Client::IncludeType(include.type)));
+    }
+    restoreMacros(document, entry.macros);
+
+    document->setUtf8Source(qUncompress(entry.compressedSource));
+    document->keepSourceAndAST();
+    document->tokenize();
+    document->check(Document::FastCheck);
+
+    return document;
+}
+
+void CppSnapshotCache::rememberDocument(const Document::Ptr &document,
+                                        const QByteArray &preprocessedCode)
+{
+    if (CacheDisabled)
+        return;
+    if (preprocessedCode.size() > maxCachedSourceSize)
+        return;
+
+    const QFileInfo info(document->fileName());
+    if (!info.exists())
+        return;
+
+    Entry entry;
+    entry.lastModified = document->lastModified();
+    entry.fileSize = info.size();
+    entry.languageFeatures = document->languageFeatures().flags;
+    entry.fingerprint = document->fingerprint();
+    entry.compressedSource = qCompress(preprocessedCode);
+
+    foreach (const Document::Include &include,
+             document->resolvedIncludes() + document->unresolvedIncludes()) {
+        IncludeData data;
+        data.unresolvedFileName = include.unresolvedFileName();
+        data.resolvedFileName = include.resolvedFileName();
+        data.line = include.line();
+        data.type = include.type();
+        entry.includes.append(data);
+    }
+
+    foreach (const Macro &macro, document->definedMacros()) {
+        MacroData data;
+        data.name = macro.name();
+        data.formals = macro.formals();
+        data.definitionText = macro.definitionText();
+        data.fileName = macro.fileName();
+        data.line = macro.line();
+        data.bytesOffset = macro.bytesOffset();
+        data.utf16charsOffset = macro.utf16CharOffset();
+        data.hidden = macro.isHidden();
+        data.functionLike = macro.isFunctionLike();
+        data.variadic = macro.isVariadic();
+        entry.macros.append(data);
+    }
+
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    checkConfiguration();
+    m_entries.insert(document->fileName(), entry);
+    m_dirty = true;
+}
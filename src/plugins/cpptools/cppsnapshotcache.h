@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt Creator.
+**
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+****************************************************************************/
+
+#pragma once
+
+#include "cppworkingcopy.h"
+
+#include <cplusplus/CppDocument.h>
+
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+
+namespace CppTools {
+namespace Internal {
+
+// Documentation inside.
+class CppSnapshotCache
+{
+    Q_DISABLE_COPY(CppSnapshotCache)
+
+public:
+    static CppSnapshotCache *instance();
+
+    CPlusPlus::Document::Ptr restoreDocument(const QString &filePath,
+                                             CPlusPlus::LanguageFeatures languageFeatures,
+                                             const WorkingCopy &workingCopy);
+    void rememberDocument(const CPlusPlus::Document::Ptr &document,
+                          const QByteArray &preprocessedCode);
+
+    void save();
+    void clear();
+
+private:
+    CppSnapshotCache();
+
+    class MacroData
+    {
+    public:
+        QByteArray name;
+        QVector<QByteArray> formals;
+        QByteArray definitionText;
+        QString fileName;
+        unsigned line = 0;
+        unsigned bytesOffset = 0;
+        unsigned utf16charsOffset = 0;
+        bool hidden = false;
+        bool functionLike = false;
+        bool variadic = false;
+    };
+
+    class IncludeData
+    {
+    public:
+        QString unresolvedFileName;
+        QString resolvedFileName;
+        unsigned line = 0;
+        int type = 0;
+    };
+
+    class Entry
+    {
+    public:
+        QDateTime lastModified;
+        qint64 fileSize = -1;
+        unsigned languageFeatures = 0;
+        QByteArray fingerprint;
+        QByteArray compressedSource;
+        QList<IncludeData> includes;
+        QList<MacroData> macros;
+    };
+
+    void ensureLoaded();
+    void checkConfiguration();
+    bool isEntryValid(const QString &filePath, const WorkingCopy &workingCopy,
+                      QSet<QString> *validated) const;
+    bool loadFile(const QString &filePath);
+    QByteArray configurationFingerprint() const;
+    static QString cacheFilePath();
+
+    friend QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::MacroData &macro);
+    friend QDataStream &operator>>(QDataStream &in, CppSnapshotCache::MacroData &macro);
+    friend QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::IncludeData &include);
+    friend QDataStream &operator>>(QDataStream &in, CppSnapshotCache::IncludeData &include);
+    friend QDataStream &operator<<(QDataStream &out, const CppSnapshotCache::Entry &entry);
+    friend QDataStream &operator>>(QDataStream &in, CppSnapshotCache::Entry &entry);
+
+    mutable QMutex m_mutex;
+    bool m_loaded = false;
+    bool m_dirty = false;
+    QByteArray m_configuration; // the fingerprint m_entries were produced under
+    QHash<QString, Entry> m_entries;
+};
+
+} // namespace Internal
+} // namespace CppTools
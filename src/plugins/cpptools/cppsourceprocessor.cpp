@@ -26,6 +26,7 @@
 #include "cppsourceprocessor.h"
 
 #include "cppmodelmanager.h"
+#include "cppsnapshotcache.h"
 #include "cpptoolsreuse.h"
 
 #include <coreplugin/editormanager/editormanager.h>
@@ -143,6 +144,9 @@ void CppSourceProcessor::setHeaderPaths(const ProjectPartHeaderPaths &headerPath
     }
 }
 
+void CppSourceProcessor::setUsesSnapshotCache(bool usesSnapshotCache)
+{ m_usesSnapshotCache = usesSnapshotCache; }
+
 void CppSourceProcessor::setLanguageFeatures(const LanguageFeatures languageFeatures)
 {
     m_languageFeatures = languageFeatures;
@@ -409,6 +413,27 @@ void CppSourceProcessor::mergeEnvironment(Document::Ptr doc)
     m_env.addMacros(doc->definedMacros());
 }
 
+// Returns whether the document's include closure contains a file whose
+// contents came from the working copy rather than from disk.
+// \a checked memoizes visited files and breaks include cycles.
+bool CppSourceProcessor::includesWorkingCopyFile(const CPlusPlus::Document::Ptr &document,
+                                                 QSet<QString> *checked) const
+{
+    foreach (const Document::Include &include, document->resolvedIncludes()) {
+        const QString includedFile = include.resolvedFileName();
+        if (checked->contains(includedFile))
+            continue;
+        checked->insert(includedFile);
+        if (m_workingCopy.contains(includedFile))
+            return true;
+        if (Document::Ptr included = m_snapshot.document(includedFile)) {
+            if (includesWorkingCopyFile(included, checked))
+                return true;
+        }
+    }
+    return false;
+}
+
 void CppSourceProcessor::startSkippingBlocks(unsigned utf16charsOffset)
 {
     if (m_currentDoc)
@@ -451,6 +476,25 @@ void CppSourceProcessor::sourceNeeded(unsigned line, const QString &fileName, In
     if (fileSizeExceedsLimit(info, m_fileSizeLimitInMb))
         return; // TODO: Add diagnostic message
 
+    // Check the persistent snapshot cache before running the preprocessor.
+    // Editor document parsers preprocess under per-project-part defines and
+    // header paths, for which the globally-configured cache entries would be
+    // wrong; only processors running under the merged global configuration
+    // opt in.
+    if (m_usesSnapshotCache
+            && !m_workingCopy.contains(absoluteFileName)
+            && !isInjectedFile(absoluteFileName)) {
+        if (Document::Ptr restored = CppSnapshotCache::instance()->restoreDocument(
+                    absoluteFileName, m_languageFeatures, m_workingCopy)) {
+            qCDebug(log) << "Restored from snapshot cache:" << absoluteFileName;
+            mergeEnvironment(restored);
+            m_documentFinished(restored);
+            m_snapshot.insert(restored);
+            m_todo.remove(absoluteFileName);
+            return;
+        }
+    }
+
     // Otherwise get file contents
     unsigned editorRevision = 0;
     QByteArray contents;
@@ -491,6 +535,17 @@ void CppSourceProcessor::sourceNeeded(unsigned line, const QString &fileName, In
         return;
     }
 
+    // Files that do not belong to any project - typically system or library
+    // headers such as Boost - are only ever looked up for their declarations.
+    // Let the parser skip the statements inside function bodies for them: the
+    // binder ignores those anyway in a FastCheck, and the stubbed-out bodies
+    // keep the resident AST and symbol memory of the snapshot small.
+    if (!m_workingCopy.contains(absoluteFileName)
+            && !isInjectedFile(absoluteFileName)
+            && CppModelManager::instance()->projectPart(absoluteFileName).isEmpty()) {
+        document->setSkipFunctionBody(true);
+    }
+
     // Otherwise process the document
     document->setUtf8Source(preprocessedCode);
     document->keepSourceAndAST();
@@ -500,6 +555,18 @@ void CppSourceProcessor::sourceNeeded(unsigned line, const QString &fileName, In
 
     m_documentFinished(document);
 
+    // A document whose include closure pulled anything from the working copy
+    // baked unsaved editor contents into its preprocessed source; remembering
+    // it would let later sessions restore contents that may never have
+    // existed on disk.
+    if (m_usesSnapshotCache
+            && !m_workingCopy.contains(absoluteFileName)
+            && !isInjectedFile(absoluteFileName)) {
+        QSet<QString> checked;
+        if (!includesWorkingCopyFile(document, &checked))
+            CppSnapshotCache::instance()->rememberDocument(document, preprocessedCode);
+    }
+
     m_snapshot.insert(document);
     m_todo.remove(absoluteFileName);
     switchCurrentDocument(previousDocument);
@@ -64,6 +64,7 @@ public:
 
     void setWorkingCopy(const CppTools::WorkingCopy &workingCopy);
     void setHeaderPaths(const ProjectPartHeaderPaths &headerPaths);
+    void setUsesSnapshotCache(bool usesSnapshotCache);
     void setLanguageFeatures(CPlusPlus::LanguageFeatures languageFeatures);
     void setFileSizeLimitInMb(int fileSizeLimitInMb);
     void setTodo(const QSet<QString> &files);
@@ -90,6 +91,8 @@ private:
                                ProjectPartHeaderPaths::Iterator headerPathsIt);
 
     void mergeEnvironment(CPlusPlus::Document::Ptr doc);
+    bool includesWorkingCopyFile(const CPlusPlus::Document::Ptr &document,
+                                 QSet<QString> *checked) const;
 
     // Client interface
     void macroAdded(const CPlusPlus::Macro &macro) override;
@@ -124,6 +127,9 @@ private:
     QSet<QString> m_processed;
     QHash<QString, QString> m_fileNameCache;
     int m_fileSizeLimitInMb = -1;
+    // CppSnapshotCache entries are only valid under the merged global
+    // configuration the indexer runs with, so cache use is opt-in.
+    bool m_usesSnapshotCache = false;
     QTextCodec *m_defaultCodec;
 };
 
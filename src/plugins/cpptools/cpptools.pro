@@ -52,6 +52,7 @@ HEADERS += \
     cppselectionchanger.h \
     cppsemanticinfo.h \
     cppsemanticinfoupdater.h \
+    cppsnapshotcache.h \
     cppsourceprocessor.h \
     cpptools_global.h \
     cpptools_utils.h \
@@ -136,6 +137,7 @@ SOURCES += \
     cpprefactoringchanges.cpp \
     cppselectionchanger.cpp \
     cppsemanticinfoupdater.cpp \
+    cppsnapshotcache.cpp \
     cppsourceprocessor.cpp \
     cpptoolsjsextension.cpp \
     cpptoolsplugin.cpp \
@@ -25,6 +25,7 @@
 
 #include "cpptoolsconstants.h"
 #include "cpptoolsplugin.h"
+#include "cppchecksymbols.h"
 #include "cppfilesettingspage.h"
 #include "cppcodemodelsettingspage.h"
 #include "cppcodestylesettingspage.h"
@@ -40,6 +41,7 @@
 #include "cppprojectfile.h"
 #include "cpplocatordata.h"
 #include "cppincludesfilter.h"
+#include "cppsnapshotcache.h"
 #include "cpptoolsbridge.h"
 #include "projectinfo.h"
 #include "cpptoolsbridgeqtcreatorimplementation.h"
@@ -164,6 +166,9 @@ bool CppToolsPlugin::initialize(const QStringList &arguments, QString *error)
     connect(modelManager, &CppModelManager::aboutToRemoveFiles,
             locatorData, &CppLocatorData::onAboutToRemoveFiles);
 
+    connect(modelManager, &CppModelManager::aboutToRemoveFiles,
+            &CheckSymbols::evictCachedSymbols);
+
     addAutoReleasedObject(locatorData);
     addAutoReleasedObject(new CppLocatorFilter(locatorData));
     addAutoReleasedObject(new CppClassesFilter(locatorData));
@@ -224,6 +229,7 @@ void CppToolsPlugin::extensionsInitialized()
 
 ExtensionSystem::IPlugin::ShutdownFlag CppToolsPlugin::aboutToShutdown()
 {
+    CppSnapshotCache::instance()->save();
     return SynchronousShutdown;
 }
 
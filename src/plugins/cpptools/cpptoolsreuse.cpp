@@ -268,6 +268,14 @@ int indexerFileSizeLimitInMb()
     return -1;
 }
 
+int indexerThreadCount()
+{
+    const QSharedPointer<CppCodeModelSettings> settings = codeModelSettings();
+    QTC_ASSERT(settings, return 1);
+
+    return settings->indexerThreadCount();
+}
+
 bool fileSizeExceedsLimit(const QFileInfo &fileInfo, int sizeLimitInMb)
 {
     if (sizeLimitInMb <= 0)
@@ -77,6 +77,7 @@ QSharedPointer<CppCodeModelSettings> CPPTOOLS_EXPORT codeModelSettings();
 CompilerOptionsBuilder::PchUsage CPPTOOLS_EXPORT getPchUsage();
 
 int indexerFileSizeLimitInMb();
+int indexerThreadCount();
 bool fileSizeExceedsLimit(const QFileInfo &fileInfo, int sizeLimitInMb);
 
 } // CppTools
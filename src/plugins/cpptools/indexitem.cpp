@@ -33,7 +33,9 @@ IndexItem::Ptr IndexItem::create(const QString &symbolName, const QString &symbo
                                  const QString &symbolScope, IndexItem::ItemType type,
                                  const QString &fileName, int line, int column, const QIcon &icon)
 {
-    Ptr ptr(new IndexItem);
+    // QSharedPointer::create puts the reference counts and the item into one
+    // allocation; with one item per indexed symbol the difference matters.
+    Ptr ptr = Ptr::create();
 
     ptr->m_symbolName = symbolName;
     ptr->m_symbolType = symbolType;
@@ -49,7 +51,7 @@ IndexItem::Ptr IndexItem::create(const QString &symbolName, const QString &symbo
 
 IndexItem::Ptr IndexItem::create(const QString &fileName, int sizeHint)
 {
-    Ptr ptr(new IndexItem);
+    Ptr ptr = Ptr::create();
 
     ptr->m_fileName = fileName;
     ptr->m_type = Declaration;
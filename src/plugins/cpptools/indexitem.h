@@ -39,6 +39,7 @@ class CPPTOOLS_EXPORT IndexItem
 {
     Q_DISABLE_COPY(IndexItem)
 
+    friend class QSharedPointer<IndexItem>; // To give create() access to our constructor.
     IndexItem() {}
 
 public:
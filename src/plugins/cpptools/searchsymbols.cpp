@@ -294,11 +294,13 @@ IndexItem::Ptr SearchSymbols::addChildItem(const QString &symbolName, const QStr
     }
 
     const QIcon icon = Icons::iconForSymbol(symbol);
-    IndexItem::Ptr newItem = IndexItem::create(findOrInsert(symbolName),
-                                               findOrInsert(symbolType),
-                                               findOrInsert(symbolScope),
+    QString interned[] = {symbolName, symbolType, symbolScope, path};
+    strings.insert(interned, 4);
+    IndexItem::Ptr newItem = IndexItem::create(interned[0],
+                                               interned[1],
+                                               interned[2],
                                                itemType,
-                                               findOrInsert(path),
+                                               interned[3],
                                                symbol->line(),
                                                symbol->column() - 1, // 1-based vs 0-based column
                                                icon);
@@ -41,7 +41,8 @@ StringTable::StringTable()
     : m_gcRunner(*this)
     , m_stopGCRequested(false)
 {
-    m_strings.reserve(1000);
+    for (int i = 0; i < ShardCount; ++i)
+        m_shards[i].strings.reserve(1000 / ShardCount);
 
     m_gcRunner.setAutoDelete(false);
 
@@ -51,6 +52,11 @@ StringTable::StringTable()
     connect(&m_gcCountDown, &QTimer::timeout, this, &StringTable::startGC);
 }
 
+StringTable::Shard &StringTable::shardOf(const QString &string)
+{
+    return m_shards[qHash(string) & (ShardCount - 1)];
+}
+
 QString StringTable::insert(const QString &string)
 {
     if (string.isEmpty())
@@ -62,12 +68,47 @@ QString StringTable::insert(const QString &string)
 
     m_stopGCRequested.fetchAndStoreAcquire(true);
 
-    QMutexLocker locker(&m_lock);
-    QString result = *m_strings.insert(string);
+    Shard &shard = shardOf(string);
+    QMutexLocker locker(&shard.lock);
+    QString result = *shard.strings.insert(string);
     m_stopGCRequested.fetchAndStoreRelease(false);
     return result;
 }
 
+/*!
+    Interns  count strings in place. Strings mapping to the same shard are
+    inserted under a single lock acquisition, so bulk-interning from indexer
+    workers does not serialize per string.
+*/
+void StringTable::insert(QString *strings, int count)
+{
+    m_stopGCRequested.fetchAndStoreAcquire(true);
+
+    for (int shardIndex = 0; shardIndex < ShardCount; ++shardIndex) {
+        Shard &shard = m_shards[shardIndex];
+        bool locked = false;
+        for (int i = 0; i < count; ++i) {
+            QString &string = strings[i];
+            if (string.isEmpty())
+                continue;
+#ifndef QT_NO_UNSHARABLE_CONTAINERS
+            QTC_ASSERT(string.data_ptr()->ref.isSharable(), continue);
+#endif
+            if (int(qHash(string) & (ShardCount - 1)) != shardIndex)
+                continue;
+            if (!locked) {
+                shard.lock.lock();
+                locked = true;
+            }
+            string = *shard.strings.insert(string);
+        }
+        if (locked)
+            shard.lock.unlock();
+    }
+
+    m_stopGCRequested.fetchAndStoreRelease(false);
+}
+
 void StringTable::scheduleGC()
 {
     QMetaObject::invokeMethod(&m_gcCountDown, "start", Qt::QueuedConnection);
@@ -90,28 +131,37 @@ static inline bool isQStringInUse(const QString &string)
 
 void StringTable::GC()
 {
-    QMutexLocker locker(&m_lock);
-
     int initialSize = 0;
+    int currentSize = 0;
     QTime startTime;
     if (DebugStringTable) {
-        initialSize = m_strings.size();
+        for (int shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
+            initialSize += m_shards[shardIndex].strings.size();
         startTime = QTime::currentTime();
     }
 
-    // Collect all QStrings which have refcount 1. (One reference in m_strings and nowhere else.)
-    for (QSet<QString>::iterator i = m_strings.begin(); i != m_strings.end();) {
-        if (m_stopGCRequested.testAndSetRelease(true, false))
-            return;
-
-        if (!isQStringInUse(*i))
-            i = m_strings.erase(i);
-        else
-            ++i;
+    // Collect all QStrings which have refcount 1. (One reference in the shard and nowhere else.)
+    // Each shard is processed under its own lock, so interning threads only
+    // wait for the shard currently being swept.
+    for (int shardIndex = 0; shardIndex < ShardCount; ++shardIndex) {
+        Shard &shard = m_shards[shardIndex];
+        QMutexLocker locker(&shard.lock);
+
+        for (QSet<QString>::iterator i = shard.strings.begin(); i != shard.strings.end();) {
+            if (m_stopGCRequested.testAndSetRelease(true, false))
+                return;
+
+            if (!isQStringInUse(*i))
+                i = shard.strings.erase(i);
+            else
+                ++i;
+        }
+
+        if (DebugStringTable)
+            currentSize += shard.strings.size();
     }
 
     if (DebugStringTable) {
-        const int currentSize = m_strings.size();
         qDebug() << "StringTable::GC removed" << initialSize - currentSize
                  << "strings in" << startTime.msecsTo(QTime::currentTime())
                  << "ms, size is now" << currentSize;
@@ -43,6 +43,7 @@ public:
     StringTable();
 
     QString insert(const QString &string);
+    void insert(QString *strings, int count);
     void scheduleGC();
 
 private:
@@ -59,9 +60,21 @@ private:
     friend class GCRunner;
 
 private:
-    mutable QMutex m_lock;
+    enum { ShardCount = 16 }; // must be a power of two
+
+    // Interning is striped over several independently locked sets, so
+    // parallel indexer threads mostly hit different locks.
+    class Shard
+    {
+    public:
+        mutable QMutex lock;
+        QSet<QString> strings;
+    };
+
+    Shard &shardOf(const QString &string);
+
     QAtomicInt m_stopGCRequested;
-    QSet<QString> m_strings;
+    Shard m_shards[ShardCount];
     QTimer m_gcCountDown;
 };
 
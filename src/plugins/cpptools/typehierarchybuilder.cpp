@@ -47,7 +47,8 @@ public:
         , _unqualifiedName(unqualifyName(qualifiedName))
     {}
 
-    void execute(const CPlusPlus::Document::Ptr &doc, const CPlusPlus::Snapshot &snapshot);
+    void execute(const CPlusPlus::Document::Ptr &doc, const CPlusPlus::Snapshot &snapshot,
+                 const QSharedPointer<CPlusPlus::CreateBindings> &bindings);
 
     virtual bool visit(CPlusPlus::Class *);
 
@@ -65,11 +66,13 @@ private:
 };
 
 void DerivedHierarchyVisitor::execute(const CPlusPlus::Document::Ptr &doc,
-                                      const CPlusPlus::Snapshot &snapshot)
+                                      const CPlusPlus::Snapshot &snapshot,
+                                      const QSharedPointer<CPlusPlus::CreateBindings> &bindings)
 {
     _derived.clear();
     _otherBases.clear();
-    _context = CPlusPlus::LookupContext(doc, snapshot);
+    bindings->process(doc); // no-op for documents that were bound before
+    _context = CPlusPlus::LookupContext(doc, doc, snapshot, bindings);
 
     for (unsigned i = 0; i < doc->globalSymbolCount(); ++i)
         accept(doc->globalSymbolAt(i));
@@ -144,6 +147,11 @@ void TypeHierarchyBuilder::reset()
 {
     _visited.clear();
     _candidates.clear();
+    // The documents depending on the symbol largely share their include
+    // trees, so bind them into one CreateBindings instead of rebuilding
+    // the bindings from scratch for every visited document.
+    _bindings = QSharedPointer<CPlusPlus::CreateBindings>(
+                new CPlusPlus::CreateBindings(CPlusPlus::Document::Ptr(), _snapshot));
 }
 
 TypeHierarchy TypeHierarchyBuilder::buildDerivedTypeHierarchy()
@@ -174,7 +182,7 @@ void TypeHierarchyBuilder::buildDerived(TypeHierarchy *typeHierarchy,
             continue;
         }
 
-        visitor.execute(doc, _snapshot);
+        visitor.execute(doc, _snapshot, _bindings);
         _candidates.insert(fileName, QSet<QString>());
 
         foreach (const QString &candidate, visitor.otherBases())
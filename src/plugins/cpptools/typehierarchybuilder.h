@@ -32,9 +32,12 @@
 
 #include <QList>
 #include <QSet>
+#include <QSharedPointer>
 
 QT_FORWARD_DECLARE_CLASS(QStringList)
 
+namespace CPlusPlus { class CreateBindings; }
+
 namespace CppTools {
 
 class CPPTOOLS_EXPORT TypeHierarchy
@@ -73,6 +76,9 @@ private:
     QSet<CPlusPlus::Symbol *> _visited;
     QHash<QString, QSet<QString> > _candidates;
     CPlusPlus::Overview _overview;
+    // Shared between all lookup contexts of one hierarchy walk, so that
+    // every document is bound at most once.
+    QSharedPointer<CPlusPlus::CreateBindings> _bindings;
 };
 
 } // CppTools
@@ -1717,7 +1717,11 @@ void BreakpointItem::insertSubBreakpoint(const BreakpointResponse &params)
         l = new LocationItem;
         l->params = params;
         appendChild(l);
-        expand();
+        // Expand only on the first location. A breakpoint in a template or
+        // inline function can have hundreds of locations, and asking the
+        // views to expand once per appended child adds up.
+        if (childCount() == 1)
+            expand();
     }
 }
 
@@ -2431,6 +2431,11 @@ void CdbEngine::parseOutputLine(QString line)
         QTC_ASSERT(whatEndPos != -1, return);
         const QString what = line.mid(whatPos, whatEndPos - whatPos);
         // Build up buffer, call handler once last chunk was encountered
+        if (m_extensionMessageBuffer.isEmpty() && remainingChunks > 0) {
+            // A locals dump can run into megabytes; size the buffer once
+            // instead of growing it chunk by chunk.
+            m_extensionMessageBuffer.reserve((remainingChunks + 1) * (line.size() - whatEndPos));
+        }
         m_extensionMessageBuffer += line.mid(whatEndPos + 1);
         if (remainingChunks == 0) {
             handleExtensionMessage(type, token, what, m_extensionMessageBuffer);
@@ -60,7 +60,7 @@ uchar fromhex(uchar c)
 
 void skipCommas(const QChar *&from, const QChar *to)
 {
-    while (*from == ',' && from != to)
+    while (from != to && *from == ',')
         ++from;
 }
 
@@ -227,12 +227,17 @@ void GdbMi::parseTuple_helper(const QChar *&from, const QChar *to)
             ++from;
             break;
         }
-        GdbMi child;
+        // Parse in place; going through a local GdbMi would copy three
+        // ref-counted members per node, which adds up on dumper output with
+        // hundreds of thousands of nodes.
+        m_children.append(GdbMi());
+        GdbMi &child = m_children.last();
         child.parseResultOrValue(from, to);
         //qDebug() << "\n=======\n" << qPrintable(child.toString()) << "\n========\n";
-        if (!child.isValid())
+        if (!child.isValid()) {
+            m_children.removeLast();
             return;
-        m_children.push_back(child);
+        }
         skipCommas(from, to);
     }
 }
@@ -249,12 +254,13 @@ void GdbMi::parseList(const QChar *&from, const QChar *to)
             ++from;
             break;
         }
-        GdbMi child;
+        m_children.append(GdbMi());
+        GdbMi &child = m_children.last();
         child.parseResultOrValue(from, to);
         if (child.isValid()) {
-            m_children.push_back(child);
             skipCommas(from, to);
         } else {
+            m_children.removeLast();
             ++from;
         }
     }
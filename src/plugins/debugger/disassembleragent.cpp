@@ -107,6 +107,12 @@ bool FrameKey::matches(const Location &loc) const
 
 typedef QPair<FrameKey, DisassemblerLines> CacheEntry;
 
+// Upper bound for cached disassembled frames. The cache is kept in
+// least-recently-used order, so stepping back and forth between a few
+// functions does not refetch, while long sessions do not accumulate
+// the disassembly of every function ever visited.
+enum { maxCacheEntries = 20 };
+
 
 ///////////////////////////////////////////////////////////////////////
 //
@@ -230,11 +236,16 @@ void DisassemblerAgent::setLocation(const Location &loc)
         // Refresh when not displaying a function and there is not sufficient
         // context left past the address.
         if (d->cache.at(index).first.endAddress - loc.address() < 24) {
-            index = -1;
             d->cache.removeAt(index);
+            index = -1;
         }
     }
     if (index != -1) {
+        // Mark the entry as most recently used.
+        if (index != d->cache.size() - 1) {
+            d->cache.append(d->cache.takeAt(index));
+            index = d->cache.size() - 1;
+        }
         const FrameKey &key = d->cache.at(index).first;
         const QString msg =
             QString("Using cached disassembly for 0x%1 (0x%2-0x%3) in \"%4\"/ \"%5\"")
@@ -292,6 +303,8 @@ void DisassemblerAgent::setContents(const DisassemblerLines &contents)
             key.startAddress = startAddress;
             key.endAddress = endAddress;
             d->cache.append(CacheEntry(key, contents));
+            while (d->cache.size() > maxCacheEntries)
+                d->cache.removeFirst();
         }
     }
     setContentsToDocument(contents);
@@ -213,6 +213,7 @@ GdbEngine::GdbEngine(bool useTerminal)
     m_pythonVersion = 0;
     m_isQnxGdb = false;
     m_registerNamesListed = false;
+    m_registerValuesFetched = false;
     m_sourcesListUpdating = false;
     m_oldestAcceptableToken = -1;
     m_nonDiscardableCount = 0;
@@ -3343,16 +3344,48 @@ void GdbEngine::reloadRegisters()
                         CB(handleRegisterListing)});
             m_registerNamesListed = true;
         }
-        // Can cause i386-linux-nat.c:571: internal-error: Got request
-        // for bad register number 41.\nA problem internal to GDB has been detected.
-        runCommand({"-data-list-register-values r", Discardable,
-                    CB(handleRegisterListValues)});
+        if (m_registerValuesFetched) {
+            // Transfer only the registers that changed since the last
+            // fetch. The full set is several kilobytes per stop, which
+            // adds up while stepping over a remote gdbserver link.
+            runCommand({"-data-list-changed-registers", Discardable,
+                        CB(handleChangedRegisterList)});
+        } else {
+            // Can cause i386-linux-nat.c:571: internal-error: Got request
+            // for bad register number 41.\nA problem internal to GDB has been detected.
+            runCommand({"-data-list-register-values r", Discardable,
+                        CB(handleRegisterListValues)});
+        }
     } else {
         runCommand({"maintenance print cooked-registers",
                     CB(handleMaintPrintRegisters)});
     }
 }
 
+void GdbEngine::handleChangedRegisterList(const DebuggerResponse &response)
+{
+    if (response.resultClass != ResultDone) {
+        // Fall back to a full fetch.
+        runCommand({"-data-list-register-values r", Discardable,
+                    CB(handleRegisterListValues)});
+        return;
+    }
+
+    QString numbers;
+    foreach (const GdbMi &item, response.data["changed-registers"].children()) {
+        if (m_registers.contains(item.data().toInt()))
+            numbers += ' ' + item.data();
+    }
+
+    registerHandler()->resetChangedFlags();
+    if (numbers.isEmpty()) {
+        registerHandler()->commitUpdates();
+        return;
+    }
+    runCommand({"-data-list-register-values r" + numbers, Discardable,
+                CB(handleRegisterListValues)});
+}
+
 static QString readWord(const QString &ba, int *pos)
 {
     const int n = ba.size();
@@ -3471,6 +3504,7 @@ void GdbEngine::handleRegisterListValues(const DebuggerResponse &response)
     if (response.resultClass != ResultDone)
         return;
 
+    m_registerValuesFetched = true;
     RegisterHandler *handler = registerHandler();
     // 24^done,register-values=[{number="0",value="0xf423f"},...]
     const GdbMi values = response.data["register-values"];
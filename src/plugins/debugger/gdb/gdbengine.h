@@ -91,6 +91,7 @@ private: ////////// General State //////////
     void reloadLocals();
 
     bool m_registerNamesListed;
+    bool m_registerValuesFetched;
 
 protected: ////////// Gdb Process Management //////////
 
@@ -294,6 +295,7 @@ private: ////////// View & Data Stuff //////////
     void setRegisterValue(const QString &name, const QString &value) override;
     void handleRegisterListNames(const DebuggerResponse &response);
     void handleRegisterListing(const DebuggerResponse &response);
+    void handleChangedRegisterList(const DebuggerResponse &response);
     void handleRegisterListValues(const DebuggerResponse &response);
     void handleMaintPrintRegisters(const DebuggerResponse &response);
     QHash<int, Register> m_registers; // Map GDB register numbers to indices
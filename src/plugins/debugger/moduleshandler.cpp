@@ -33,6 +33,7 @@
 #include <utils/basetreeview.h>
 #include <utils/hostosinfo.h>
 #include <utils/qtcassert.h>
+#include <utils/runextensions.h>
 #include <utils/savedaction.h>
 #include <utils/treemodel.h>
 
@@ -289,6 +290,17 @@ void ModulesHandler::removeModule(const QString &modulePath)
         m_model->destroyItem(item);
 }
 
+static ElfData readElfData(const QString &path)
+{
+    try { // MinGW occasionallly throws std::bad_alloc.
+        return ElfReader::cachedHeaders(path);
+    } catch(...) {
+        qWarning("%s: An exception occurred while reading module '%s'",
+                 Q_FUNC_INFO, qPrintable(path));
+    }
+    return ElfData();
+}
+
 void ModulesHandler::updateModule(const Module &module)
 {
     const QString path = module.modulePath;
@@ -297,22 +309,32 @@ void ModulesHandler::updateModule(const Module &module)
 
     ModuleItem *item = moduleFromPath(path);
     if (item) {
+        // The module data from the engine does not contain ELF data.
+        // Keep what a previous examination found out.
+        const ElfData elfData = item->module.elfData;
         item->module = module;
+        item->module.elfData = elfData;
     } else {
         item = new ModuleItem;
         item->module = module;
         m_model->rootItem()->appendChild(item);
     }
-
-    try { // MinGW occasionallly throws std::bad_alloc.
-        ElfReader reader(path);
-        item->module.elfData = reader.readHeaders();
-        item->update();
-    } catch(...) {
-        qWarning("%s: An exception occurred while reading module '%s'",
-                 Q_FUNC_INFO, qPrintable(module.modulePath));
-    }
     item->updated = true;
+    item->update();
+
+    if (item->module.elfData.symbolsType != UnknownSymbols)
+        return; // Already examined.
+
+    // Reading the ELF headers is plain file I/O that does not involve the
+    // debugger. Do it in the background; attaching to a process with
+    // hundreds of shared objects otherwise blocks the GUI for seconds.
+    onResultReady(runAsync(readElfData, path), this,
+        [this, path](const ElfData &elfData) {
+            if (ModuleItem *item = moduleFromPath(path)) {
+                item->module.elfData = elfData;
+                item->update();
+            }
+        });
 }
 
 void ModulesHandler::beginUpdateAll()
@@ -28,6 +28,8 @@
 #include "demanglerexceptions.h"
 #include "parsetreenodes.h"
 
+#include <QHash>
+
 #include <limits>
 
 namespace Debugger {
@@ -41,6 +43,12 @@ public:
     const QString &demangledName() const { return m_demangledName; }
 
 private:
+    // Parsing allocates a tree node per grammar element, which makes
+    // demangling the same name over and over needlessly expensive.
+    // Remember successful results, as stack traces tend to repeat frames.
+    enum { MaxCachedNames = 1000 };
+    QHash<QString, QString> m_cache;
+
     GlobalParseState m_parseState;
     QString m_errorString;
     QString m_demangledName;
@@ -49,6 +57,12 @@ private:
 
 bool NameDemanglerPrivate::demangle(const QString &mangledName)
 {
+    const QHash<QString, QString>::ConstIterator cached = m_cache.constFind(mangledName);
+    if (cached != m_cache.constEnd()) {
+        m_demangledName = cached.value();
+        return true;
+    }
+
     bool success;
     try {
         m_parseState.m_mangledName = mangledName.toLatin1();
@@ -86,6 +100,12 @@ bool NameDemanglerPrivate::demangle(const QString &mangledName)
     m_parseState.m_parseStack.clear();
     m_parseState.m_substitutions.clear();
     m_parseState.m_templateParams.clear();
+
+    if (success) {
+        if (m_cache.count() >= MaxCachedNames)
+            m_cache.clear();
+        m_cache.insert(mangledName, m_demangledName);
+    }
     return success;
 }
 
@@ -203,7 +203,9 @@ void QmlInspectorAgent::updateWatchData(const WatchItem &data)
     if (data.id != WatchItem::InvalidId && !m_fetchDataIds.contains(data.id)) {
         // objects
         m_fetchDataIds << data.id;
-        fetchObject(data.id);
+        // Fetch the whole subtree in one query. Expanding level by level
+        // costs a round trip per object, which dominates on large scenes.
+        fetchObjectRecursive(data.id);
     }
 }
 
@@ -442,6 +444,20 @@ void QmlInspectorAgent::fetchObject(int debugId)
     m_objectTreeQueryIds << queryId;
 }
 
+void QmlInspectorAgent::fetchObjectRecursive(int debugId)
+{
+    qCDebug(qmlInspectorLog) << __FUNCTION__ << '(' << debugId << ')';
+
+    if (!isConnected() || !boolSetting(ShowQmlObjectTree))
+        return;
+
+    log(LogSend, QLatin1String("FETCH_OBJECT_RECURSIVE ") + QString::number(debugId));
+    quint32 queryId = m_engineClient->queryObjectRecursive(debugId);
+    qCDebug(qmlInspectorLog) << __FUNCTION__ << '(' << debugId << ')'
+                             << " - query id" << queryId;
+    m_objectTreeQueryIds << queryId;
+}
+
 void QmlInspectorAgent::updateObjectTree(const ContextReference &context)
 {
     qCDebug(qmlInspectorLog) << __FUNCTION__ << '(' << context << ')';
@@ -73,6 +73,7 @@ private:
     QString displayName(int objectDebugId) const;
     void reloadEngines();
     void fetchObject(int debugId);
+    void fetchObjectRecursive(int debugId);
 
     void updateState();
     void onResult(quint32 queryId, const QVariant &value, const QByteArray &type);
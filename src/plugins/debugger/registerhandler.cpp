@@ -643,6 +643,15 @@ void RegisterHandler::updateRegister(const Register &r)
     }
 }
 
+// Used by engines that fetch only the changed registers after a stop.
+// Registers not reported back keep their value, but must lose the
+// "changed" marker from the previous stop.
+void RegisterHandler::resetChangedFlags()
+{
+    for (int i = 0, n = rootItem()->childCount(); i != n; ++i)
+        rootItem()->childAt(i)->m_changed = false;
+}
+
 RegisterMap RegisterHandler::registerMap() const
 {
     RegisterMap result;
@@ -115,6 +115,7 @@ public:
     QAbstractItemModel *model() { return this; }
 
     void updateRegister(const Register &reg);
+    void resetChangedFlags();
     void commitUpdates() { emit layoutChanged(); }
     RegisterMap registerMap() const;
 
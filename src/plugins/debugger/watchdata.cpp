@@ -194,6 +194,14 @@ QString WatchItem::msgNotInScope()
     return rc;
 }
 
+QString WatchItem::msgMoreItems(int n)
+{
+    //: Value of the marker item appended to a container in the Debugger
+    //: Locals display when the dumper sent only part of the elements.
+    return QCoreApplication::translate("Debugger::Internal::WatchItem",
+                                       "<%n more items>", 0, n);
+}
+
 const QString &WatchItem::shadowedNameFormat()
 {
     //: Display of variables shadowed by variables of the same name
@@ -395,6 +403,17 @@ void WatchItem::parseHelper(const GdbMi &input, bool maySort)
         decoder.addrstep = input["addrstep"].toAddress();
         decoder.encoding = DebuggerEncoding(input["arrayencoding"].data());
         decoder.decode();
+        mi = input["childrenelided"];
+        if (mi.isValid()) {
+            // The dumper capped the number of elements it sent. Show the
+            // truncation as the non-array children path does.
+            auto incomplete = new WatchItem;
+            incomplete->iname = iname + ".incomplete";
+            incomplete->name = QLatin1String("<incomplete>");
+            incomplete->value = msgMoreItems(mi.toInt() - childCount());
+            incomplete->setHasChildren(false);
+            appendChild(incomplete);
+        }
     } else {
         const GdbMi children = input["children"];
         if (children.isValid()) {
@@ -73,6 +73,7 @@ public:
     QString toString() const;
 
     static QString msgNotInScope();
+    static QString msgMoreItems(int n);
     static QString shadowedName(const QString &name, int seen);
     static const QString &shadowedNameFormat();
 
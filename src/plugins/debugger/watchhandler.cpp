@@ -1977,6 +1977,14 @@ void WatchHandler::insertItems(const GdbMi &data)
 {
     QSet<WatchItem *> itemsToSort;
 
+    // The dumper reports items as a flat list of siblings. Finding each
+    // one's parent by a full tree scan and its predecessor by a linear scan
+    // over the parent's children makes insertion quadratic in the number of
+    // reported items, which dominates step latency for large containers.
+    // Remember parents and child rows across the batch instead.
+    QHash<QString, WatchItem *> parentCache;
+    QHash<WatchItem *, QHash<QString, int>> rowCache;
+
     const bool sortStructMembers = boolSetting(SortStructMembers);
     foreach (const GdbMi &child, data.children()) {
         auto item = new WatchItem;
@@ -1985,9 +1993,42 @@ void WatchHandler::insertItems(const GdbMi &data)
         if (ti.size && !item->size)
             item->size = ti.size;
 
-        const bool added = insertItem(item);
+        QTC_ASSERT(!item->iname.isEmpty(), delete item; continue);
+        const QString parentIName = parentName(item->iname);
+        WatchItem *parent = parentCache.value(parentIName);
+        if (!parent) {
+            parent = m_model->findItem(parentIName);
+            QTC_ASSERT(parent, delete item; continue);
+            parentCache.insert(parentIName, parent);
+        }
+
+        QHash<QString, int> &rows = rowCache[parent];
+        if (rows.isEmpty()) {
+            for (int row = 0, n = parent->childCount(); row < n; ++row)
+                rows.insert(static_cast<WatchItem *>(parent->childAt(row))->iname, row);
+        }
+
+        bool added = false;
+        const auto it = rows.constFind(item->iname);
+        if (it != rows.constEnd()) {
+            WatchItem *old = static_cast<WatchItem *>(parent->childAt(*it));
+            // The old item could show up as a parent later in this batch.
+            parentCache.remove(old->iname);
+            rowCache.remove(old);
+            m_model->destroyItem(old);
+            parent->insertChild(*it, item);
+        } else {
+            rows.insert(item->iname, parent->childCount());
+            parent->appendChild(item);
+            added = true;
+        }
+
+        item->update();
+        m_model->showEditValue(item);
+        item->forAllChildren([this](WatchItem *sub) { m_model->showEditValue(sub); });
+
         if (added && item->level() == 2)
-            itemsToSort.insert(static_cast<WatchItem *>(item->parent()));
+            itemsToSort.insert(parent);
     }
 
     foreach (WatchItem *toplevel, itemsToSort)
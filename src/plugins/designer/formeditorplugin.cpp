@@ -46,6 +46,8 @@
 #include <coreplugin/designmode.h>
 #include <cpptools/cpptoolsconstants.h>
 #include <projectexplorer/jsonwizard/jsonwizardfactory.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/session.h>
 #include <utils/mimetypes/mimedatabase.h>
 
 #include <QAction>
@@ -133,6 +135,24 @@ void FormEditorPlugin::extensionsInitialized()
     mformtools->addAction(cmd, Core::Constants::G_DEFAULT_THREE);
 }
 
+bool FormEditorPlugin::delayedInitialize()
+{
+    // Fully initializing the form editor loads the Designer widget plugins
+    // and creates all subwindows, which takes seconds on a cold start. When
+    // the session contains forms, do that now in the idle slice after
+    // startup instead of stalling the first time a form is opened. Sessions
+    // without forms keep the lazy initialization and pay nothing.
+    foreach (ProjectExplorer::Project *project, ProjectExplorer::SessionManager::projects()) {
+        foreach (const QString &file, project->files(ProjectExplorer::Project::SourceFiles)) {
+            if (file.endsWith(QLatin1String(".ui"), Qt::CaseInsensitive)) {
+                FormEditorW::ensureInitStage(FormEditorW::FullyInitialized);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 ////////////////////////////////////////////////////
 //
 // PRIVATE functions
@@ -46,6 +46,7 @@ public:
     //Plugin
     bool initialize(const QStringList &arguments, QString *errorMessage = 0) override;
     void extensionsInitialized() override;
+    bool delayedInitialize() override;
 
 #ifdef WITH_TESTS
 private slots:
@@ -36,6 +36,7 @@ publication by Neil Fraser: http://neil.fraser.name/writing/diff/
 #include <QList>
 #include <QRegularExpression>
 #include <QStringList>
+#include <QHash>
 #include <QMap>
 #include <QPair>
 #include <QCoreApplication>
@@ -1276,7 +1277,7 @@ QStringList Differ::encode(const QString &text1,
 {
     QStringList lines;
     lines.append(QLatin1String("")); // don't use code: 0
-    QMap<QString, int> lineToCode;
+    QHash<QString, int> lineToCode;
 
     *encodedText1 = encode(text1, &lines, &lineToCode);
     *encodedText2 = encode(text2, &lines, &lineToCode);
@@ -1307,7 +1308,7 @@ int Differ::findSubtextEnd(const QString &text,
 
 QString Differ::encode(const QString &text,
                               QStringList *lines,
-                              QMap<QString, int> *lineToCode)
+                              QHash<QString, int> *lineToCode)
 {
     int subtextStart = 0;
     int subtextEnd = -1;
@@ -1317,13 +1318,14 @@ QString Differ::encode(const QString &text,
         const QString line = text.mid(subtextStart, subtextEnd - subtextStart);
         subtextStart = subtextEnd;
 
-        if (lineToCode->contains(line)) {
-            codes += QChar(static_cast<ushort>(lineToCode->value(line)));
-        } else {
+        // one hash lookup per subtext instead of two ordered-map searches
+        int code = lineToCode->value(line, -1);
+        if (code < 0) {
             lines->append(line);
-            lineToCode->insert(line, lines->count() - 1);
-            codes += QChar(static_cast<ushort>(lines->count() - 1));
+            code = lines->count() - 1;
+            lineToCode->insert(line, code);
         }
+        codes += QChar(static_cast<ushort>(code));
     }
     return codes;
 }
@@ -30,7 +30,7 @@
 
 QT_BEGIN_NAMESPACE
 template <class K, class T>
-class QMap;
+class QHash;
 class QFutureInterfaceBase;
 QT_END_NAMESPACE
 
@@ -106,7 +106,7 @@ private:
                        QString *encodedText2);
     QString encode(const QString &text,
                    QStringList *lines,
-                   QMap<QString, int> *lineToCode);
+                   QHash<QString, int> *lineToCode);
     int findSubtextEnd(const QString &text,
                        int subTextStart);
     DiffMode m_diffMode;
@@ -106,16 +106,23 @@ void SelectableTextEditorWidget::paintBlock(QPainter *painter,
                                             const QRect &clipRect) const
 {
     const int blockNumber = block.blockNumber();
-    QList<DiffSelection> diffs = m_diffSelections.value(blockNumber);
+    const QList<DiffSelection> diffs = m_diffSelections.value(blockNumber);
+    if (diffs.isEmpty()) {
+        TextEditorWidget::paintBlock(painter, block, offset, selections, clipRect);
+        return;
+    }
 
+    // block.text() copies the block contents, don't call it per selection
+    const int textCount = block.text().count();
     QVector<QTextLayout::FormatRange> newSelections;
+    newSelections.reserve(diffs.count() + selections.count());
     for (const DiffSelection &diffSelection : diffs) {
         if (diffSelection.format) {
             QTextLayout::FormatRange formatRange;
             formatRange.start = qMax(0, diffSelection.start);
             const int end = diffSelection.end < 0
-                    ? block.text().count() + 1
-                    : qMin(block.text().count(), diffSelection.end);
+                    ? textCount + 1
+                    : qMin(textCount, diffSelection.end);
 
             formatRange.length = end - formatRange.start;
             formatRange.format = *diffSelection.format;
@@ -692,7 +692,7 @@ static bool substituteText(QString *text, QRegExp &pattern, const QString &repla
         right = text->size() - pos;
 
         substituted = true;
-        QString matched = text->mid(pos, pattern.cap(0).size());
+        const int matchedLength = pattern.matchedLength();
         QString repl;
         bool escape = false;
         // insert captured texts
@@ -715,8 +715,8 @@ static bool substituteText(QString *text, QRegExp &pattern, const QString &repla
                     repl += c;
             }
         }
-        text->replace(pos, matched.size(), repl);
-        pos += (repl.isEmpty() && matched.isEmpty()) ? 1 : repl.size();
+        text->replace(pos, matchedLength, repl);
+        pos += (repl.isEmpty() && matchedLength == 0) ? 1 : repl.size();
 
         if (pos >= text->size() || !global)
             break;
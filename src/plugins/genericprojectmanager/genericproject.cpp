@@ -337,9 +337,13 @@ void GenericProject::parseProject(RefreshOptions options)
 void GenericProject::refresh(RefreshOptions options)
 {
     emitParsingStarted();
+    const QStringList oldFiles = m_files;
     parseProject(options);
 
-    if (options & Files) {
+    // File events often leave the processed file list unchanged, e.g. when a
+    // listed file was merely saved. Rebuilding the whole project tree in that
+    // case would throw away the tree state for nothing.
+    if ((options & Files) && (m_files != oldFiles || !rootProjectNode())) {
         auto newRoot = new GenericProjectNode(this);
 
         for (const QString &f : m_files) {
@@ -76,6 +76,7 @@
 #include <QPushButton>
 #include <QRegExp>
 #include <QTextCodec>
+#include <QTextCursor>
 #include <QToolButton>
 
 const char GIT_DIRECTORY[] = ".git";
@@ -804,7 +805,20 @@ void GitClient::log(const QString &workingDirectory, const QString &fileName,
     if (!fileName.isEmpty())
         arguments << "--follow" << "--" << fileName;
 
-    vcsExec(workingDir, arguments, editor);
+    // Stream the output into the editor while git is still producing it:
+    // for long histories the first page is readable long before the last
+    // requested entry has been generated.
+    VcsCommand *command = createCommand(workingDir, nullptr);
+    editor->setCommand(command);
+    command->setCodec(editor->codec());
+    command->setProgressiveOutput(true);
+    editor->setPlainText(QString());
+    connect(command, &VcsCommand::stdOutText, editor, [editor](const QString &text) {
+        QTextCursor cursor(editor->document());
+        cursor.movePosition(QTextCursor::End);
+        cursor.insertText(text);
+    });
+    enqueueJob(command, arguments);
 }
 
 void GitClient::reflog(const QString &workingDirectory)
@@ -1224,16 +1238,22 @@ QString GitClient::synchronousShortDescription(const QString &workingDirectory,
 QString GitClient::synchronousCurrentLocalBranch(const QString &workingDirectory) const
 {
     QString branch;
-    const SynchronousProcessResponse resp = vcsFullySynchronousExec(
-                workingDirectory, {"symbolic-ref", HEAD}, silentFlags);
-    if (resp.result == SynchronousProcessResponse::Finished) {
-        branch = resp.stdOut().trimmed();
-    } else {
-        const QString gitDir = findGitDirForRepository(workingDirectory);
+    // reading the HEAD file directly is much cheaper than spawning
+    // git symbolic-ref, and this runs whenever the topic cache refreshes
+    const QString gitDir = findGitDirForRepository(workingDirectory);
+    QFile head(gitDir + "/HEAD");
+    if (head.open(QFile::ReadOnly)) {
+        const QString headContent = QString::fromUtf8(head.readLine()).trimmed();
+        const QString refPrefix = "ref: ";
+        if (headContent.startsWith(refPrefix))
+            branch = headContent.mid(refPrefix.count());
+    }
+    if (branch.isEmpty()) {
+        // detached HEAD; during a rebase the checked out branch is recorded separately
         const QString rebaseHead = gitDir + "/rebase-merge/head-name";
-        QFile head(rebaseHead);
-        if (head.open(QFile::ReadOnly))
-            branch = QString::fromUtf8(head.readLine()).trimmed();
+        QFile rebaseFile(rebaseHead);
+        if (rebaseFile.open(QFile::ReadOnly))
+            branch = QString::fromUtf8(rebaseFile.readLine()).trimmed();
     }
     if (!branch.isEmpty()) {
         const QString refsHeadsPrefix = "refs/heads/";
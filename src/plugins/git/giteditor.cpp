@@ -154,13 +154,17 @@ static QString sanitizeBlameOutput(const QString &b)
 
     // Copy over the parts that have not changed into a new byte array
     QString result;
+    // the result is only a few columns shorter than the input, so allocating
+    // the full size up front avoids repeatedly growing a multi-MB string for
+    // blame output of large files
+    result.reserve(b.size());
     int prevPos = 0;
     int pos = b.indexOf('\n', 0) + 1;
     forever {
         QTC_CHECK(prevPos < pos);
         int afterParen = prevPos + parenPos;
-        result.append(b.mid(prevPos, stripPos));
-        result.append(b.mid(afterParen, pos - afterParen));
+        result.append(b.midRef(prevPos, stripPos));
+        result.append(b.midRef(afterParen, pos - afterParen));
         prevPos = pos;
         QTC_CHECK(prevPos != 0);
         if (pos == b.size())
@@ -55,6 +55,7 @@
 #include <coreplugin/editormanager/editormanager.h>
 #include <coreplugin/editormanager/ieditor.h>
 #include <coreplugin/locator/commandlocator.h>
+#include <coreplugin/progressmanager/progressmanager.h>
 #include <coreplugin/vcsmanager.h>
 
 #include <coreplugin/messagebox.h>
@@ -62,6 +63,7 @@
 #include <utils/qtcassert.h>
 #include <utils/parameteraction.h>
 #include <utils/pathchooser.h>
+#include <utils/runextensions.h>
 #include <utils/utilsicons.h>
 #include <texteditor/texteditor.h>
 
@@ -936,28 +938,36 @@ void GitPlugin::startCommit(CommitType commitType)
     const VcsBasePluginState state = currentState();
     QTC_ASSERT(state.hasTopLevel(), return);
 
-    QString errorMessage, commitTemplate;
-    CommitData data(commitType);
-    if (!m_gitClient->getCommitData(state.topLevel(), &commitTemplate, data, &errorMessage)) {
-        VcsOutputWindow::appendError(errorMessage);
-        return;
-    }
-
-    // Store repository for diff and the original list of
-    // files to be able to unstage files the user unchecks
-    m_submitRepository = data.panelInfo.repository;
-
-    // Start new temp file with message template
-    TempFileSaver saver;
-    // Keep the file alive, else it removes self and forgets its name
-    saver.setAutoRemove(false);
-    saver.write(commitTemplate.toLocal8Bit());
-    if (!saver.finalize()) {
-        VcsOutputWindow::appendError(saver.errorString());
-        return;
-    }
-    m_commitMessageFileName = saver.fileName();
-    openSubmitEditor(m_commitMessageFileName, data);
+    // Gather and parse the status in the background; with many modified
+    // files this takes long enough to freeze the UI otherwise.
+    QFuture<CommitDataFetchResult> fetchFuture
+            = Utils::runAsync(&CommitDataFetchResult::fetch, commitType, state.topLevel());
+    ProgressManager::addTask(fetchFuture, tr("Preparing Commit"), "Git.PrepareCommit");
+    Utils::onResultReady(fetchFuture, this, [this](const CommitDataFetchResult &result) {
+        if (isCommitEditorOpen())
+            return; // another commit was started in the meantime
+        if (!result.success) {
+            VcsOutputWindow::appendError(result.errorMessage);
+            return;
+        }
+        const CommitData &data = result.commitData;
+
+        // Store repository for diff and the original list of
+        // files to be able to unstage files the user unchecks
+        m_submitRepository = data.panelInfo.repository;
+
+        // Start new temp file with message template
+        TempFileSaver saver;
+        // Keep the file alive, else it removes self and forgets its name
+        saver.setAutoRemove(false);
+        saver.write(result.commitTemplate.toLocal8Bit());
+        if (!saver.finalize()) {
+            VcsOutputWindow::appendError(saver.errorString());
+            return;
+        }
+        m_commitMessageFileName = saver.fileName();
+        openSubmitEditor(m_commitMessageFileName, data);
+    });
 }
 
 void GitPlugin::updateVersionWarning()
@@ -87,8 +87,7 @@ CommitDataFetchResult CommitDataFetchResult::fetch(CommitType commitType, const
 {
     CommitDataFetchResult result;
     result.commitData.commitType = commitType;
-    QString commitTemplate;
-    result.success = GitPlugin::client()->getCommitData(workingDirectory, &commitTemplate,
+    result.success = GitPlugin::client()->getCommitData(workingDirectory, &result.commitTemplate,
                                                         result.commitData, &result.errorMessage);
     return result;
 }
@@ -47,6 +47,7 @@ public:
     static CommitDataFetchResult fetch(CommitType commitType, const QString &workingDirectory);
 
     QString errorMessage;
+    QString commitTemplate;
     CommitData commitData;
     bool success;
 };
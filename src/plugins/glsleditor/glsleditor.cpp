@@ -57,6 +57,7 @@
 
 #include <utils/changeset.h>
 #include <utils/qtcassert.h>
+#include <utils/runextensions.h>
 #include <utils/uncommentselection.h>
 
 #include <QCoreApplication>
@@ -64,9 +65,12 @@
 #include <QComboBox>
 #include <QFileInfo>
 #include <QHeaderView>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QTextBlock>
 #include <QTimer>
 #include <QTreeView>
+#include <QVector>
 
 using namespace TextEditor;
 using namespace GLSL;
@@ -195,29 +199,50 @@ void GlslEditorWidget::updateDocumentNow()
 {
     m_updateDocumentTimer.stop();
 
-    int variant = languageVariant(textDocument()->mimeType());
+    const int variant = languageVariant(textDocument()->mimeType());
     const QString contents = toPlainText(); // get the code from the editor
-    const QByteArray preprocessedCode = contents.toLatin1(); // ### use the QtCreator C++ preprocessor.
-
-    Document::Ptr doc(new Document());
-    doc->_engine = new Engine();
-    Parser parser(doc->_engine, preprocessedCode.constData(), preprocessedCode.size(), variant);
-    TranslationUnitAST *ast = parser.parse();
-    if (ast != 0 || extraSelections(CodeWarningsSelection).isEmpty()) {
+    const int revision = document()->revision();
+
+    // The builtin init documents are created lazily, which must happen in the
+    // gui thread, so fetch them before handing the work to the pool.
+    QVector<const GlslEditorPlugin::InitFile *> initFiles;
+    initFiles.append(GlslEditorPlugin::shaderInit(variant));
+    if (variant & Lexer::Variant_VertexShader)
+        initFiles.append(GlslEditorPlugin::vertexShaderInit(variant));
+    if (variant & Lexer::Variant_FragmentShader)
+        initFiles.append(GlslEditorPlugin::fragmentShaderInit(variant));
+
+    // Parsing and the semantic checks only operate on the snapshot taken
+    // above, so they can run in a worker thread. The result is applied in the
+    // gui thread, and dropped if the document was edited in the meantime.
+    QFuture<Document::Ptr> future
+            = Utils::runAsync([contents, variant, initFiles]() -> Document::Ptr {
+        const QByteArray preprocessedCode = contents.toLatin1(); // ### use the QtCreator C++ preprocessor.
+
+        Document::Ptr doc(new Document());
+        doc->_engine = new Engine();
+        Parser parser(doc->_engine, preprocessedCode.constData(), preprocessedCode.size(), variant);
+        doc->_ast = parser.parse();
+
+        // The init documents are shared between all editors; the semantic
+        // pass resolves types through their engines, so serialize access.
+        static QMutex initFileMutex;
+        QMutexLocker locker(&initFileMutex);
         Semantic sem;
         Scope *globalScope = new Namespace();
         doc->_globalScope = globalScope;
-        const GlslEditorPlugin::InitFile *file = GlslEditorPlugin::shaderInit(variant);
-        sem.translationUnit(file->ast, globalScope, file->engine);
-        if (variant & Lexer::Variant_VertexShader) {
-            file = GlslEditorPlugin::vertexShaderInit(variant);
-            sem.translationUnit(file->ast, globalScope, file->engine);
-        }
-        if (variant & Lexer::Variant_FragmentShader) {
-            file = GlslEditorPlugin::fragmentShaderInit(variant);
+        foreach (const GlslEditorPlugin::InitFile *file, initFiles)
             sem.translationUnit(file->ast, globalScope, file->engine);
-        }
-        sem.translationUnit(ast, globalScope, doc->_engine);
+        sem.translationUnit(doc->_ast, globalScope, doc->_engine);
+        return doc;
+    });
+
+    Utils::onResultReady(future, this, [this, revision](const Document::Ptr &doc) {
+        if (document()->revision() != revision)
+            return; // the document was edited again, a reparse is pending
+        TranslationUnitAST *ast = doc->_ast;
+        if (ast == 0 && !extraSelections(CodeWarningsSelection).isEmpty())
+            return; // keep the previous state on unparseable input
 
         CreateRanges createRanges(document(), doc);
         createRanges(ast);
@@ -250,7 +275,7 @@ void GlslEditorWidget::updateDocumentNow()
 
         setExtraSelections(CodeWarningsSelection, sels);
         m_glslDocument = doc;
-    }
+    });
 }
 
 int languageVariant(const QString &type)
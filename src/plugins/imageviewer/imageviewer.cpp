@@ -158,6 +158,11 @@ void ImageViewer::ctor()
             d->imageView, &ImageView::reset);
     connect(d->file.data(), &ImageViewerFile::reloadFinished,
             d->imageView, &ImageView::createScene);
+    connect(d->file.data(), &ImageViewerFile::imageChanged,
+            d->imageView, [this]() {
+        d->imageView->reset();
+        d->imageView->createScene();
+    });
     connect(d->file.data(), &ImageViewerFile::isPausedChanged,
             this, &ImageViewer::updatePauseAction);
     connect(d->imageView, &ImageView::scaleFactorChanged,
@@ -32,6 +32,7 @@
 #include <utils/fileutils.h>
 #include <utils/mimetypes/mimedatabase.h>
 #include <utils/qtcassert.h>
+#include <utils/runextensions.h>
 
 #include <QFileInfo>
 #include <QGraphicsPixmapItem>
@@ -129,16 +130,30 @@ Core::IDocument::OpenResult ImageViewerFile::openImpl(QString *errorString, cons
         m_isPaused = false; // force update
         setPaused(true);
     } else {
-        m_pixmap = new QPixmap(fileName);
-        if (m_pixmap->isNull()) {
+        QImageReader reader(fileName);
+        if (!reader.canRead()) {
             if (errorString)
                 *errorString = tr("Failed to read image.");
-            delete m_pixmap;
-            m_pixmap = 0;
             return OpenResult::CannotHandle;
         }
         m_type = TypePixmap;
-        emit imageSizeChanged(m_pixmap->size());
+        m_pixmap = new QPixmap;
+        const QSize size = reader.size(); // only reads the header for most formats
+        if (size.isValid())
+            emit imageSizeChanged(size);
+        // Decoding a large image can take seconds, so do it in a worker thread
+        // instead of blocking the editor. The views rebuild their scenes
+        // through imageChanged() once the data is available.
+        QFuture<QImage> future = Utils::runAsync([fileName] { return QImage(fileName); });
+        Utils::onResultReady(future, this, [this](const QImage &image) {
+            if (m_type != TypePixmap || !m_pixmap)
+                return; // the document was reloaded with a different type in the meantime
+            if (image.isNull())
+                return;
+            *m_pixmap = QPixmap::fromImage(image);
+            emit imageSizeChanged(m_pixmap->size());
+            emit imageChanged();
+        });
     }
 
     setFilePath(Utils::FileName::fromString(fileName));
@@ -74,6 +74,7 @@ public:
 signals:
     void openFinished(bool success);
     void imageSizeChanged(const QSize &size);
+    void imageChanged();
     void isPausedChanged(bool paused);
 
 private:
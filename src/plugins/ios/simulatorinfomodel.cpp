@@ -40,6 +40,9 @@ const int nameCol = 0;
 const int runtimeCol = 1;
 const int stateCol = 2;
 static const int deviceUpdateInterval = 1000; // Update simulator state every 1 sec.
+// Polling spawns a simctl process each time. Back off up to this interval
+// while nothing changes; any change resets to deviceUpdateInterval.
+static const int maxDeviceUpdateInterval = 16000;
 
 SimulatorInfoModel::SimulatorInfoModel(QObject *parent) :
     QAbstractItemModel(parent)
@@ -48,10 +51,9 @@ SimulatorInfoModel::SimulatorInfoModel(QObject *parent) :
 
     requestSimulatorInfo();
 
-    auto updateTimer = new QTimer(this);
-    connect(updateTimer, &QTimer::timeout, this, &SimulatorInfoModel::requestSimulatorInfo);
-    updateTimer->setInterval(deviceUpdateInterval);
-    updateTimer->start();
+    connect(&m_updateTimer, &QTimer::timeout, this, &SimulatorInfoModel::requestSimulatorInfo);
+    m_updateTimer.setInterval(deviceUpdateInterval);
+    m_updateTimer.start();
 }
 
 QVariant SimulatorInfoModel::data(const QModelIndex &index, int role) const
@@ -136,6 +138,12 @@ void SimulatorInfoModel::requestSimulatorInfo()
 
 void SimulatorInfoModel::populateSimulators(const SimulatorInfoList &simulatorList)
 {
+    if (!m_simList.isEmpty() && m_simList == simulatorList) {
+        m_updateTimer.setInterval(qMin(m_updateTimer.interval() * 2, maxDeviceUpdateInterval));
+        return;
+    }
+    m_updateTimer.setInterval(deviceUpdateInterval);
+
     if (m_simList.isEmpty() || m_simList.count() != simulatorList.count()) {
         // Reset the model in case of addition or deletion.
         beginResetModel();
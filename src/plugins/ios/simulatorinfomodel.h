@@ -29,6 +29,7 @@
 
 #include <QAbstractListModel>
 #include <QFutureSynchronizer>
+#include <QTimer>
 
 namespace Ios {
 namespace Internal {
@@ -57,6 +58,7 @@ private:
 private:
     QFutureSynchronizer<void> m_fetchFuture;
     SimulatorInfoList m_simList;
+    QTimer m_updateTimer;
 };
 
 } // namespace Internal
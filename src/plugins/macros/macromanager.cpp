@@ -198,6 +198,18 @@ void MacroManager::MacroManagerPrivate::changeMacroDescription(Macro *macro, con
 bool MacroManager::MacroManagerPrivate::executeMacro(Macro *macro)
 {
     bool error = !macro->load();
+
+    // Block the completion popup and suspend repainting of the editor while
+    // replaying; with long macros both dominate the replay time.
+    QAction *completeAction
+            = Core::ActionManager::command(TextEditor::Constants::COMPLETE_THIS)->action();
+    completeAction->blockSignals(true);
+    QWidget *editorWidget = 0;
+    if (Core::IEditor *current = Core::EditorManager::currentEditor())
+        editorWidget = current->widget();
+    if (editorWidget)
+        editorWidget->setUpdatesEnabled(false);
+
     foreach (const MacroEvent &macroEvent, macro->events()) {
         if (error)
             break;
@@ -210,6 +222,10 @@ bool MacroManager::MacroManagerPrivate::executeMacro(Macro *macro)
         }
     }
 
+    if (editorWidget)
+        editorWidget->setUpdatesEnabled(true);
+    completeAction->blockSignals(false);
+
     if (error) {
         QMessageBox::warning(Core::ICore::mainWindow(),
                              tr("Playing Macro"),
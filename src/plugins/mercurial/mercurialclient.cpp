@@ -71,23 +71,46 @@ MercurialClient::MercurialClient() : VcsBaseClient(new MercurialSettings)
     });
 }
 
-bool MercurialClient::manifestSync(const QString &repository, const QString &relativeFilename)
+// Key for manifest lookups: the manifest lists clean, slash-separated paths
+// relative to the repository; fold the case on case-insensitive file systems.
+static inline QString manifestKey(const QString &relativeFilename)
+{
+    const QString cleanPath = QDir::cleanPath(relativeFilename);
+    return HostOsInfo::fileNameCaseSensitivity() == Qt::CaseInsensitive
+            ? cleanPath.toLower() : cleanPath;
+}
+
+QSet<QString> MercurialClient::manifestFiles(const QString &repository)
 {
+    // Every operation changing the set of tracked files (add, remove, commit,
+    // update, ...) rewrites the dirstate, so its timestamp tells whether a
+    // cached manifest is still valid. Querying one file per "hg manifest" run
+    // makes opening many files in a large repository crawl otherwise.
+    const QDateTime dirstateModified
+            = QFileInfo(repository + QLatin1String("/.hg/dirstate")).lastModified();
+    const QHash<QString, CachedManifest>::ConstIterator it = m_manifests.constFind(repository);
+    if (it != m_manifests.constEnd() && it.value().dirstateModified == dirstateModified)
+        return it.value().files;
+
     // This  only works when called from the repo and outputs paths relative to it.
     const QStringList args(QLatin1String("manifest"));
-
     const SynchronousProcessResponse result = vcsFullySynchronousExec(repository, args);
-
-    const QDir repositoryDir(repository);
-    const QFileInfo needle = QFileInfo(repositoryDir, relativeFilename);
-
-    const QStringList files = result.stdOut().split(QLatin1Char('\n'));
-    foreach (const QString &fileName, files) {
-        const QFileInfo managedFile(repositoryDir, fileName);
-        if (needle == managedFile)
-            return true;
+    if (result.result != SynchronousProcessResponse::Finished)
+        return QSet<QString>(); // Do not cache failed runs.
+
+    CachedManifest manifest;
+    manifest.dirstateModified = dirstateModified;
+    foreach (const QString &fileName, result.stdOut().split(QLatin1Char('\n'))) {
+        if (!fileName.isEmpty())
+            manifest.files.insert(manifestKey(fileName));
     }
-    return false;
+    m_manifests.insert(repository, manifest);
+    return manifest.files;
+}
+
+bool MercurialClient::manifestSync(const QString &repository, const QString &relativeFilename)
+{
+    return manifestFiles(repository).contains(manifestKey(relativeFilename));
 }
 
 //bool MercurialClient::clone(const QString &directory, const QString &url)
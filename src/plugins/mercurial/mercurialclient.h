@@ -28,6 +28,10 @@
 #include "mercurialsettings.h"
 #include <vcsbase/vcsbaseclient.h>
 
+#include <QDateTime>
+#include <QHash>
+#include <QSet>
+
 namespace Mercurial {
 namespace Internal {
 class MercurialDiffParameters;
@@ -87,6 +91,15 @@ signals:
 
 private:
     void parsePullOutput(const QString &output);
+    QSet<QString> manifestFiles(const QString &repository);
+
+    class CachedManifest
+    {
+    public:
+        QDateTime dirstateModified;
+        QSet<QString> files;
+    };
+    QHash<QString, CachedManifest> m_manifests;
 };
 
 } //namespace Internal
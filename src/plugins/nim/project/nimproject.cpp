@@ -113,13 +113,21 @@ bool NimProject::renameFile(const QString &filePath, const QString &newFilePath)
 void NimProject::collectProjectFiles()
 {
     m_lastProjectScan.start();
-    QTC_ASSERT(!m_futureWatcher.future().isRunning(), return);
+    if (m_futureWatcher.isRunning()) {
+        // The running scan would deliver stale results; cancel it and try
+        // again once it has wound down.
+        m_futureWatcher.future().cancel();
+        m_projectScanTimer.setInterval(MIN_TIME_BETWEEN_PROJECT_SCANS);
+        m_projectScanTimer.start();
+        return;
+    }
     FileName prjDir = projectDirectory();
     const QList<Core::IVersionControl *> versionControls = Core::VcsManager::versionControls();
-    QFuture<QList<ProjectExplorer::FileNode *>> future = Utils::runAsync([prjDir, versionControls] {
-        return FileNode::scanForFilesWithVersionControls(
+    QFuture<QList<ProjectExplorer::FileNode *>> future = Utils::runAsync(
+                [prjDir, versionControls](QFutureInterface<QList<ProjectExplorer::FileNode *>> &fi) {
+        fi.reportResult(FileNode::scanForFilesWithVersionControls(
                     prjDir, [](const FileName &fn) { return new FileNode(fn, FileType::Source, false); },
-                    versionControls);
+                    versionControls, &fi));
     });
     m_futureWatcher.setFuture(future);
     Core::ProgressManager::addTask(future, tr("Scanning for Nim files"), "Nim.Project.Scan");
@@ -127,7 +135,9 @@ void NimProject::collectProjectFiles()
 
 void NimProject::updateProject()
 {
-    emitParsingStarted();
+    if (m_futureWatcher.future().isCanceled())
+        return;
+
     const QStringList oldFiles = m_files;
     m_files.clear();
 
@@ -146,9 +156,12 @@ void NimProject::updateProject()
     m_files = Utils::transform(fileNodes, [](const FileNode *fn) { return fn->filePath().toString(); });
     Utils::sort(m_files, [](const QString &a, const QString &b) { return a < b; });
 
-    if (oldFiles == m_files)
+    if (oldFiles == m_files) {
+        qDeleteAll(fileNodes);
         return;
+    }
 
+    emitParsingStarted();
     auto newRoot = new NimProjectNode(*this, projectDirectory());
     newRoot->setDisplayName(displayName());
     newRoot->addNestedNodes(fileNodes);
@@ -820,6 +820,37 @@ bool PerforcePlugin::managesFile(const QString &workingDirectory, const QString
     return result.stdOut.contains(QLatin1String("depotFile"));
 }
 
+QStringList PerforcePlugin::unmanagedFiles(const QString &workingDirectory,
+                                           const QStringList &filePaths) const
+{
+    QStringList unmanaged;
+    // fstat reports files unknown to the depot on standard error; run it over
+    // batches of files instead of spawning one p4 process per file. Note that
+    // "-m1" cannot be used here since it limits the total number of results,
+    // not the number of results per file.
+    const int batchSize = 100;
+    for (int i = 0; i < filePaths.size(); i += batchSize) {
+        QStringList args;
+        args << QLatin1String("fstat");
+        const int end = qMin(i + batchSize, filePaths.size());
+        for (int j = i; j < end; ++j)
+            args << filePaths.at(j);
+        const PerforceResponse result = runP4Cmd(workingDirectory, args, RunFullySynchronous);
+        foreach (const QString &line, result.stdErr.split(QLatin1Char('\n'))) {
+            const QString trimmed = line.trimmed();
+            const int messagePos = trimmed.lastIndexOf(QLatin1String(" - "));
+            if (messagePos < 0)
+                continue;
+            const QString message = trimmed.mid(messagePos + 3);
+            if (message.startsWith(QLatin1String("no such file"))
+                    || message.startsWith(QLatin1String("file(s) not in client view"))) {
+                unmanaged.append(trimmed.left(messagePos));
+            }
+        }
+    }
+    return unmanaged;
+}
+
 bool PerforcePlugin::managesDirectoryFstat(const QString &directory)
 {
     // Cached?
@@ -82,6 +82,7 @@ public:
 
     bool managesDirectory(const QString &directory, QString *topLevel = 0);
     bool managesFile(const QString &workingDirectory, const QString &fileName) const;
+    QStringList unmanagedFiles(const QString &workingDirectory, const QStringList &filePaths) const;
     bool vcsOpen(const QString &workingDir, const QString &fileName, bool silently = false);
     bool vcsAdd(const QString &workingDir, const QString &fileName);
     bool vcsDelete(const QString &workingDir, const QString &filename);
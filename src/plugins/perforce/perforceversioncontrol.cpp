@@ -152,6 +152,12 @@ bool PerforceVersionControl::managesFile(const QString &workingDirectory, const
     return m_plugin->managesFile(workingDirectory, fileName);
 }
 
+QStringList PerforceVersionControl::unmanagedFiles(const QString &workingDirectory,
+                                                   const QStringList &filePaths) const
+{
+    return m_plugin->unmanagedFiles(workingDirectory, filePaths);
+}
+
 void PerforceVersionControl::emitRepositoryChanged(const QString &s)
 {
     emit repositoryChanged(s);
@@ -44,6 +44,8 @@ public:
     bool isVcsFileOrDirectory(const Utils::FileName &fileName) const final;
     bool managesDirectory(const QString &directory, QString *topLevel = 0) const final;
     bool managesFile(const QString &workingDirectory, const QString &fileName) const final;
+    QStringList unmanagedFiles(const QString &workingDirectory,
+                               const QStringList &filePaths) const final;
 
     bool isConfigured() const final;
     bool supportsOperation(Operation operation) const final;
@@ -83,7 +83,11 @@ void GccParser::stdError(const QString &line)
         return;
     }
 
-    QRegularExpressionMatch match = m_regExpGccNames.match(lne);
+    // The patterns below are expensive to run on every line, so check for
+    // their fixed substrings first; most stderr lines match none of them.
+    QRegularExpressionMatch match;
+    if (lne.contains(QLatin1String("gcc")) || lne.contains(QLatin1String("g++")))
+        match = m_regExpGccNames.match(lne);
     if (match.hasMatch()) {
         QString description = lne.mid(match.capturedLength());
         Task::TaskType type = Task::Error;
@@ -99,7 +103,7 @@ void GccParser::stdError(const QString &line)
         return;
     }
 
-    match = m_regExp.match(lne);
+    match = lne.contains(QLatin1Char(':')) ? m_regExp.match(lne) : QRegularExpressionMatch();
     if (match.hasMatch()) {
         Utils::FileName filename = Utils::FileName::fromUserInput(match.captured(1));
         int lineno = match.captured(3).toInt();
@@ -121,7 +125,8 @@ void GccParser::stdError(const QString &line)
         return;
     }
 
-    match = m_regExpIncluded.match(lne);
+    match = lne.contains(QLatin1String("from")) ? m_regExpIncluded.match(lne)
+                                                : QRegularExpressionMatch();
     if (match.hasMatch()) {
         newTask(Task(Task::Unknown,
                      lne.trimmed() /* description */,
@@ -42,6 +42,7 @@
 
 #include <QBuffer>
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
 #include <QFileInfo>
 #include <QFormLayout>
@@ -66,6 +67,12 @@ static const char compilerPlatformLinkerFlagsKeyC[] = "ProjectExplorer.GccToolCh
 static const char targetAbiKeyC[] = "ProjectExplorer.GccToolChain.TargetAbi";
 static const char originalTargetTripleKeyC[] = "ProjectExplorer.GccToolChain.OriginalTargetTriple";
 static const char supportedAbisKeyC[] = "ProjectExplorer.GccToolChain.SupportedAbis";
+static const char compilerTimestampKeyC[] = "ProjectExplorer.GccToolChain.CompilerTimestamp";
+static const char cachedMacrosKeyC[] = "ProjectExplorer.GccToolChain.CachedMacros";
+static const char cachedHeaderPathsKeyC[] = "ProjectExplorer.GccToolChain.CachedHeaderPaths";
+static const char cacheFlagsKeyC[] = "flags";
+static const char cacheMacrosKeyC[] = "macros";
+static const char cachePathsKeyC[] = "paths";
 static const char binaryRegexp[] = "(?:^|-|\\b)(?:gcc|g\\+\\+)(?:-([\\d.]+))?$";
 
 static const int CACHE_SIZE = 16;
@@ -119,6 +126,42 @@ HeaderPathsCache::Cache HeaderPathsCache::cache() const
     return m_cache;
 }
 
+QVariantList HeaderPathsCache::toVariantList() const
+{
+    QVariantList result;
+    foreach (const CacheItem &item, cache()) {
+        QVariantMap entry;
+        entry.insert(QLatin1String(cacheFlagsKeyC), item.first);
+        QStringList paths;
+        foreach (const HeaderPath &hp, item.second)
+            paths.append(QString::number(int(hp.kind())) + QLatin1Char('|') + hp.path());
+        entry.insert(QLatin1String(cachePathsKeyC), paths);
+        result.append(entry);
+    }
+    return result;
+}
+
+void HeaderPathsCache::fromVariantList(const QVariantList &list)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.clear();
+    foreach (const QVariant &v, list) {
+        const QVariantMap entry = v.toMap();
+        CacheItem item;
+        item.first = entry.value(QLatin1String(cacheFlagsKeyC)).toStringList();
+        foreach (const QString &path, entry.value(QLatin1String(cachePathsKeyC)).toStringList()) {
+            const int sep = path.indexOf(QLatin1Char('|'));
+            if (sep < 1)
+                continue;
+            item.second.append(HeaderPath(path.mid(sep + 1),
+                                          HeaderPath::Kind(path.left(sep).toInt())));
+        }
+        m_cache.push_back(item);
+        if (m_cache.size() > CACHE_SIZE)
+            m_cache.pop_front();
+    }
+}
+
 MacroCache::MacroCache(const MacroCache &other)
     : MacroCache()
 {
@@ -168,6 +211,35 @@ MacroCache::Cache MacroCache::cache() const
     return m_cache;
 }
 
+QVariantList MacroCache::toVariantList() const
+{
+    QVariantList result;
+    foreach (const CacheItem &item, cache()) {
+        QVariantMap entry;
+        entry.insert(QLatin1String(cacheFlagsKeyC), item.first);
+        entry.insert(QLatin1String(cacheMacrosKeyC), item.second);
+        result.append(entry);
+    }
+    return result;
+}
+
+void MacroCache::fromVariantList(const QVariantList &list)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.clear();
+    foreach (const QVariant &v, list) {
+        const QVariantMap entry = v.toMap();
+        CacheItem item;
+        item.first = entry.value(QLatin1String(cacheFlagsKeyC)).toStringList();
+        item.second = entry.value(QLatin1String(cacheMacrosKeyC)).toByteArray();
+        if (item.second.isEmpty())
+            continue;
+        m_cache.push_back(item);
+        if (m_cache.size() > CACHE_SIZE)
+            m_cache.pop_front();
+    }
+}
+
 static QByteArray runGcc(const FileName &gcc, const QStringList &arguments, const QStringList &env)
 {
     if (gcc.isEmpty() || !gcc.toFileInfo().isExecutable())
@@ -824,6 +896,16 @@ QVariantMap GccToolChain::toMap() const
     data.insert(originalTargetTripleKeyC, m_originalTargetTriple);
     QStringList abiList = Utils::transform(m_supportedAbis, &Abi::toString);
     data.insert(supportedAbisKeyC, abiList);
+
+    // Persist the probe results so that restored tool chains do not have to
+    // exec the compiler again on the next start. The compiler's time stamp
+    // invalidates the cached data when the binary changes.
+    const QDateTime timestamp = m_compilerCommand.toFileInfo().lastModified();
+    if (timestamp.isValid()) {
+        data.insert(compilerTimestampKeyC, timestamp.toMSecsSinceEpoch());
+        data.insert(cachedMacrosKeyC, m_predefinedMacrosCache.toVariantList());
+        data.insert(cachedHeaderPathsKeyC, m_headerPathsCache.toVariantList());
+    }
     return data;
 }
 
@@ -846,6 +928,13 @@ bool GccToolChain::fromMap(const QVariantMap &data)
         m_supportedAbis.append(abi);
     }
 
+    const QDateTime timestamp = m_compilerCommand.toFileInfo().lastModified();
+    if (timestamp.isValid()
+            && data.value(compilerTimestampKeyC).toLongLong() == timestamp.toMSecsSinceEpoch()) {
+        m_predefinedMacrosCache.fromVariantList(data.value(cachedMacrosKeyC).toList());
+        m_headerPathsCache.fromVariantList(data.value(cachedHeaderPathsKeyC).toList());
+    }
+
     if (!m_targetAbi.isValid())
         resetToolChain(m_compilerCommand);
 
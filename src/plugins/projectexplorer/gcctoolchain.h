@@ -59,6 +59,9 @@ public:
     void insert(const QStringList &compilerCommand, const QList<HeaderPath> &headerPaths);
     QList<HeaderPath> check(const QStringList &compilerCommand, bool *cacheHit) const;
 
+    QVariantList toVariantList() const;
+    void fromVariantList(const QVariantList &list);
+
 protected:
     using CacheItem = QPair<QStringList, QList<HeaderPath>>;
     using Cache = QList<CacheItem>;
@@ -77,6 +80,9 @@ public:
     void insert(const QStringList &compilerCommand, const QByteArray &macros);
     QByteArray check(const QStringList &compilerCommand) const;
 
+    QVariantList toVariantList() const;
+    void fromVariantList(const QVariantList &list);
+
 protected:
     using CacheItem = QPair<QStringList, QByteArray>;
     using Cache = QList<CacheItem>;
@@ -107,7 +107,11 @@ MsvcParser::MsvcParser()
 
 void MsvcParser::stdOutput(const QString &line)
 {
-    QRegularExpressionMatch match = m_additionalInfoRegExp.match(line);
+    // The additional-info pattern is anchored to eight leading spaces, so
+    // only bother running it on indented lines.
+    QRegularExpressionMatch match;
+    if (line.startsWith("        "))
+        match = m_additionalInfoRegExp.match(line);
     if (line.startsWith("        ") && !match.hasMatch()) {
         if (m_lastTask.isNull())
             return;
@@ -177,6 +181,13 @@ bool MsvcParser::processCompileLine(const QString &line)
 {
     doFlush();
 
+    // Every diagnostic the pattern accepts contains one of these words, and
+    // the pattern itself backtracks a lot on long non-matching lines.
+    if (!line.contains(QLatin1String("warning")) && !line.contains(QLatin1String("error"))
+            && !line.contains(QLatin1String("note:"))) {
+        return false;
+    }
+
     QRegularExpressionMatch match = m_compileRegExp.match(line);
     if (match.hasMatch()) {
         QPair<FileName, int> position = parseFileName(match.captured(1));
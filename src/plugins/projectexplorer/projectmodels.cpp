@@ -85,6 +85,11 @@ FlatModel::FlatModel(QObject *parent)
     connect(sm, &SessionManager::aboutToSaveSession, this, &FlatModel::saveExpandData);
     connect(sm, &SessionManager::projectAdded, this, &FlatModel::handleProjectAdded);
     connect(sm, &SessionManager::startupProjectChanged, this, [this] { layoutChanged(); });
+
+    m_timer.setInterval(200);
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &FlatModel::rebuildPendingProjects);
+
     rebuildModel();
 }
 
@@ -251,12 +256,34 @@ void FlatModel::updateSubtree(FolderNode *node)
     // FIXME: This is still excessive, should be limited to the affected subtree.
     while (FolderNode *parent = node->parentFolderNode())
         node = parent;
-    if (ContainerNode *container = node->asContainerNode())
-        addOrRebuildProjectModel(container->project());
+    ContainerNode *container = node->asContainerNode();
+    if (!container)
+        return;
+
+    // Subtree changes tend to arrive in bursts, e.g. when a VCS operation
+    // touches many files and the project managers reparse. Drop the stale
+    // wrapper nodes right away - the changed nodes may already be scheduled
+    // for deletion - but walk, sort and re-expand the subtree only once,
+    // after the burst is over.
+    if (WrapperNode *wrapper = nodeForProject(container->project()))
+        wrapper->removeChildren();
+    m_projectsToRebuild.insert(container->project());
+    m_timer.start();
+}
+
+void FlatModel::rebuildPendingProjects()
+{
+    const QSet<Project *> projects = m_projectsToRebuild;
+    m_projectsToRebuild.clear();
+    foreach (Project *project, projects)
+        addOrRebuildProjectModel(project);
 }
 
 void FlatModel::rebuildModel()
 {
+    m_projectsToRebuild.clear();
+    m_timer.stop();
+
     QList<Project *> projects = SessionManager::projects();
     QTC_CHECK(projects.size() == rootItem()->childCount());
 
@@ -302,6 +329,7 @@ void FlatModel::handleProjectAdded(Project *project)
 
 void FlatModel::handleProjectRemoved(Project *project)
 {
+    m_projectsToRebuild.remove(project);
     destroyItem(nodeForProject(project));
 }
 
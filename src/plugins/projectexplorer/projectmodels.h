@@ -91,6 +91,7 @@ private:
     static const QLoggingCategory &logger();
 
     void updateSubtree(FolderNode *node);
+    void rebuildPendingProjects();
     void rebuildModel();
     void addFolderNode(WrapperNode *parent, FolderNode *folderNode, QSet<Node *> *seen);
 
@@ -105,6 +106,7 @@ private:
     void parsingStateChanged(Project *project);
 
     QTimer m_timer;
+    QSet<Project *> m_projectsToRebuild;
     QSet<ExpandData> m_toExpand;
 };
 
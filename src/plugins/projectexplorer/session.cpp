@@ -50,6 +50,7 @@
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QHash>
 
 #include <QMessageBox>
 #include <QPushButton>
@@ -507,13 +508,17 @@ QStringList SessionManagerPrivate::dependencies(const QString &proName) const
 
 void SessionManagerPrivate::dependencies(const QString &proName, QStringList &result) const
 {
-    QStringList depends = m_depMap.value(proName);
+    // a project already in the result had its dependencies resolved before it
+    // was appended, so don't descend into the same subgraph again
+    if (result.contains(proName))
+        return;
+
+    const QStringList depends = m_depMap.value(proName);
 
     foreach (const QString &dep, depends)
         dependencies(dep, result);
 
-    if (!result.contains(proName))
-        result.append(proName);
+    result.append(proName);
 }
 
 QString SessionManagerPrivate::sessionTitle(const QString &filePath)
@@ -603,13 +608,13 @@ QList<Project *> SessionManager::projectOrder(const Project *project)
     else
         pros = d->dependenciesOrder();
 
+    QHash<QString, Project *> projectsByName;
+    for (Project *pro : projects())
+        projectsByName.insert(pro->projectFilePath().toString(), pro);
+
     foreach (const QString &proFile, pros) {
-        for (Project *pro : projects()) {
-            if (pro->projectFilePath().toString() == proFile) {
-                result << pro;
-                break;
-            }
-        }
+        if (Project *pro = projectsByName.value(proFile))
+            result << pro;
     }
 
     return result;
@@ -1053,22 +1058,28 @@ bool SessionManager::loadSession(const QString &session)
         // just use two!
         QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
         QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+
+        // Restore the editor layout and switch to the saved mode before
+        // loading the projects, so the last used editors show up right away
+        // and repaint on the progress events while the potentially slow
+        // project loading is still running.
+        d->restoreEditors(reader);
+        ModeManager::activateMode(modeId);
+        ModeManager::setFocusToCurrentMode();
+
         d->restoreProjects(fileList);
         d->sessionLoadingProgress();
         d->restoreDependencies(reader);
         d->restoreStartupProject(reader);
-        d->restoreEditors(reader);
 
         d->m_future.reportFinished();
         d->m_future = QFutureInterface<void>();
 
-        // Fall back to Project mode if the startup project is unconfigured and
-        // use the mode saved in the session otherwise
-        if (d->m_startupProject && d->m_startupProject->needsConfiguration())
-            modeId = Id(Constants::MODE_SESSION);
-
-        ModeManager::activateMode(modeId);
-        ModeManager::setFocusToCurrentMode();
+        // Fall back to Project mode if the startup project is unconfigured
+        if (d->m_startupProject && d->m_startupProject->needsConfiguration()) {
+            ModeManager::activateMode(Id(Constants::MODE_SESSION));
+            ModeManager::setFocusToCurrentMode();
+        }
     } else {
         ModeManager::activateMode(Id(Core::Constants::MODE_EDIT));
         ModeManager::setFocusToCurrentMode();
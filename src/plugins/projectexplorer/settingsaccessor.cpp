@@ -42,7 +42,10 @@
 #include <utils/qtcprocess.h>
 
 #include <QApplication>
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QDir>
+#include <QFile>
 #include <QRegExp>
 
 using namespace Utils;
@@ -1156,13 +1159,79 @@ bool SettingsAccessorPrivate::Settings::isValid() const
     return SettingsAccessor::versionFromMap(map) > -1 && !path.isEmpty();
 }
 
+namespace {
+
+// Binary side-cache for parsed settings files, keyed by the hash of the file
+// contents. Parsing a multi-MB .user file (and each of its versioned backups
+// considered by bestSettings()) through the XML reader takes seconds, while
+// streaming the ready-made QVariantMap back in is cheap. A stale or truncated
+// cache entry simply fails the hash or stream check and falls back to the
+// XML parser.
+
+const char SETTINGS_CACHE_MAGIC[] = "QtCreatorSettingsCache v1";
+
+QString settingsCacheDirectory()
+{
+    return Core::ICore::userResourcePath() + QLatin1String("/settingscache");
+}
+
+QString settingsCacheFileName(const FileName &path)
+{
+    const QByteArray pathHash = QCryptographicHash::hash(path.toString().toUtf8(),
+                                                         QCryptographicHash::Sha1).toHex();
+    return settingsCacheDirectory() + QLatin1Char('/') + QString::fromLatin1(pathHash);
+}
+
+bool readSettingsCache(const FileName &path, const QByteArray &contentsHash, QVariantMap *map)
+{
+    QFile file(settingsCacheFileName(path));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    QByteArray magic;
+    QByteArray hash;
+    stream >> magic >> hash;
+    if (magic != SETTINGS_CACHE_MAGIC || hash != contentsHash)
+        return false;
+    stream >> *map;
+    return stream.status() == QDataStream::Ok;
+}
+
+void writeSettingsCache(const FileName &path, const QByteArray &contentsHash, const QVariantMap &map)
+{
+    if (!QDir().mkpath(settingsCacheDirectory()))
+        return;
+    QFile file(settingsCacheFileName(path));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return;
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << QByteArray(SETTINGS_CACHE_MAGIC) << contentsHash << map;
+}
+
+} // Anonymous
+
 QVariantMap SettingsAccessor::readFile(const FileName &path) const
 {
+    QFile file(path.toString());
+    if (!file.open(QIODevice::ReadOnly))
+        return QVariantMap();
+    const QByteArray contentsHash
+            = QCryptographicHash::hash(file.readAll(), QCryptographicHash::Sha1);
+    file.close();
+
+    QVariantMap result;
+    if (readSettingsCache(path, contentsHash, &result))
+        return prepareSettings(result);
+
     PersistentSettingsReader reader;
     if (!reader.load(path))
         return QVariantMap();
 
-    return prepareSettings(reader.restoreValues());
+    result = reader.restoreValues();
+    writeSettingsCache(path, contentsHash, result);
+    return prepareSettings(result);
 }
 
 // -------------------------------------------------------------------------
@@ -104,11 +104,15 @@ bool sortById(const Task &task, unsigned int id)
 
 void TaskModel::addTask(const Task &task)
 {
-    Q_ASSERT(m_categories.keys().contains(task.category));
+    Q_ASSERT(m_categories.contains(task.category));
     CategoryData &data = m_categories[task.category];
     CategoryData &global = m_categories[Core::Id()];
 
-    auto it = std::lower_bound(m_tasks.begin(), m_tasks.end(),task.taskId, sortById);
+    // Tasks are created with increasing ids, so a new task almost always
+    // belongs at the end.
+    auto it = m_tasks.end();
+    if (!m_tasks.isEmpty() && m_tasks.last().taskId > task.taskId)
+        it = std::lower_bound(m_tasks.begin(), m_tasks.end(), task.taskId, sortById);
     int i = it - m_tasks.begin();
     beginInsertRows(QModelIndex(), i, i);
     m_tasks.insert(it, task);
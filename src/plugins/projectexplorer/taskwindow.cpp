@@ -46,6 +46,7 @@
 #include <QPainter>
 #include <QStyledItemDelegate>
 #include <QMenu>
+#include <QTimer>
 #include <QToolButton>
 #include <QScrollBar>
 
@@ -207,6 +208,7 @@ public:
     QToolButton *m_categoriesButton;
     QMenu *m_categoriesMenu;
     QList<QAction *> m_actions;
+    bool m_changeNotificationPending = false;
 };
 
 static QToolButton *createFilterButton(const QIcon &icon, const QString &toolTip,
@@ -428,12 +430,27 @@ void TaskWindow::addCategory(Core::Id categoryId, const QString &displayName, bo
     }
 }
 
+// Tasks tend to arrive in large batches, e.g. when a parser processes a chunk
+// of compiler output. The model rows have to be updated right away, but the
+// change notifications driving the badge and navigation state only need to go
+// out once per batch.
+void TaskWindow::notifyTasksChanged()
+{
+    if (d->m_changeNotificationPending)
+        return;
+    d->m_changeNotificationPending = true;
+    QTimer::singleShot(0, this, [this] {
+        d->m_changeNotificationPending = false;
+        emit tasksChanged();
+        navigateStateChanged();
+    });
+}
+
 void TaskWindow::addTask(const Task &task)
 {
     d->m_model->addTask(task);
 
-    emit tasksChanged();
-    navigateStateChanged();
+    notifyTasksChanged();
 
     if (task.type == Task::Error && d->m_filter->filterIncludesErrors()
             && !d->m_filter->filteredCategories().contains(task.category))
@@ -444,20 +461,19 @@ void TaskWindow::removeTask(const Task &task)
 {
     d->m_model->removeTask(task);
 
-    emit tasksChanged();
-    navigateStateChanged();
+    notifyTasksChanged();
 }
 
 void TaskWindow::updatedTaskFileName(unsigned int id, const QString &fileName)
 {
     d->m_model->updateTaskFileName(id, fileName);
-    emit tasksChanged();
+    notifyTasksChanged();
 }
 
 void TaskWindow::updatedTaskLineNumber(unsigned int id, int line)
 {
     d->m_model->updateTaskLineNumber(id, line);
-    emit tasksChanged();
+    notifyTasksChanged();
 }
 
 void TaskWindow::showTask(unsigned int id)
@@ -93,6 +93,7 @@ private:
     void saveSettings();
     void loadSettings();
 
+    void notifyTasksChanged();
     void triggerDefaultHandler(const QModelIndex &index);
     void actionTriggered();
     void setShowWarnings(bool);
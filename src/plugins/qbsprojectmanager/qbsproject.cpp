@@ -489,10 +489,11 @@ void QbsProject::handleQbsParsingDone(bool success)
 
     generateErrors(m_qbsProjectParser->error());
 
-    m_qbsProject = m_qbsProjectParser->qbsProject();
-    m_qbsProjects.insert(activeTarget(), m_qbsProject);
+    const qbs::Project project = m_qbsProjectParser->qbsProject();
     bool dataChanged = false;
     if (success) {
+        m_qbsProject = project;
+        m_qbsProjects.insert(activeTarget(), m_qbsProject);
         QTC_ASSERT(m_qbsProject.isValid(), return);
         const qbs::ProjectData &projectData = m_qbsProject.projectData();
         if (projectData != m_projectData) {
@@ -500,6 +501,14 @@ void QbsProject::handleQbsParsingDone(bool success)
             dataChanged = true;
         }
     } else {
+        // Keep the previous resolve result in place. A failed re-resolve,
+        // e.g. due to a syntax error introduced while editing a project file,
+        // should not take down the stale but usable project data and code
+        // model along with it.
+        if (!m_qbsProject.isValid()) {
+            m_qbsProject = project;
+            m_qbsProjects.insert(activeTarget(), m_qbsProject);
+        }
         m_qbsUpdateFutureInterface->reportCanceled();
     }
 
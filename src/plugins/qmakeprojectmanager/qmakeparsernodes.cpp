@@ -48,6 +48,11 @@
 #include <utils/stringutils.h>
 #include <utils/QtConcurrentTools>
 
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
 #include <QLoggingCategory>
 #include <QMessageBox>
 #include <QTextCodec>
@@ -113,6 +118,7 @@ public:
     QtSupport::ProFileReader *readerCumulative;
     QMakeGlobals *qmakeGlobals;
     QMakeVfs *qmakeVfs;
+    bool includedInExactParse = true;
 };
 
 class QmakePriFileEvalResult
@@ -126,7 +132,11 @@ public:
 class QmakeIncludedPriFile
 {
 public:
-    ProFile *proFile;
+    ProFile *proFile = nullptr;
+    // Subdir project references are evaluated separately and thus have no
+    // associated ProFile. Results restored from the evaluation cache have no
+    // ProFile either, so the distinction is kept in an explicit flag.
+    bool isSubDirProject = false;
     Utils::FileName name;
     QmakePriFileEvalResult result;
     QMap<Utils::FileName, QmakeIncludedPriFile *> children;
@@ -1201,6 +1211,7 @@ QmakeEvalInput QmakeProFile::evalInput() const
     input.readerCumulative = m_readerCumulative;
     input.qmakeGlobals = m_project->qmakeGlobals();
     input.qmakeVfs = m_project->qmakeVfs();
+    input.includedInExactParse = includedInExactParse();
     return input;
 }
 
@@ -1251,15 +1262,273 @@ static bool evaluateOne(const QmakeEvalInput &input, ProFile *pro,
     return true;
 }
 
+// Persistent evaluation cache ------------------------------------------------
+//
+// Complete evaluation results are cached on disk, keyed by the modification
+// state of everything that contributed to them: the .pro file itself, all
+// .pri, mkspec and feature files the evaluator pulled in, and the folders
+// from which wildcard entries were expanded. On a warm project open the
+// qmake evaluation is skipped entirely for subtrees whose inputs have not
+// changed since the last run.
+
+static const quint32 EVAL_CACHE_MAGIC = 0x514d4543; // "QMEC"
+static const quint32 EVAL_CACHE_VERSION = 1;
+
+static QString evalCacheFilePath(const QmakeEvalInput &input)
+{
+    const QByteArray key = QCryptographicHash::hash(
+                (input.projectFilePath.toString() + QLatin1Char('\n')
+                 + input.buildDirectory.toString()).toUtf8(),
+                QCryptographicHash::Sha1).toHex();
+    return ICore::userResourcePath() + QLatin1String("/qmakecache/")
+            + QString::fromLatin1(key);
+}
+
+// Identifies the configuration the result was produced under. A mismatch in
+// any of these invalidates the cache even if no input file changed.
+static QByteArray evalCacheFingerprint(const QmakeEvalInput &input)
+{
+    QByteArray blob;
+    QDataStream stream(&blob, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << EVAL_CACHE_VERSION << input.projectFilePath.toString()
+           << input.buildDirectory.toString() << input.sysroot.toString()
+           << input.includedInExactParse << input.qmakeGlobals->qmake_abslocation
+           << QFileInfo(input.qmakeGlobals->qmake_abslocation).lastModified().toMSecsSinceEpoch()
+           << input.qmakeGlobals->qmake_args << input.qmakeGlobals->qmakespec
+           << input.qmakeGlobals->xqmakespec << input.qmakeGlobals->precmds
+           << input.qmakeGlobals->postcmds;
+    QStringList environment = input.qmakeGlobals->environment.toStringList();
+    environment.sort(); // the order is unspecified
+    stream << environment;
+    return QCryptographicHash::hash(blob, QCryptographicHash::Sha1);
+}
+
+static void writeEvalCacheDependencies(QDataStream &stream, const QmakeEvalInput &input,
+                                       const QmakeEvalResult &result)
+{
+    QSet<QString> paths;
+    paths.insert(input.projectFilePath.toString());
+    foreach (const QString &file,
+             input.readerExact->values(QLatin1String("QMAKE_INTERNAL_INCLUDED_FILES")))
+        paths.insert(file);
+    foreach (const QString &file,
+             input.readerCumulative->values(QLatin1String("QMAKE_INTERNAL_INCLUDED_FILES")))
+        paths.insert(file);
+
+    // Wildcard entries are expanded from these folders, so their modification
+    // times contribute to the result as well.
+    QList<const QmakeIncludedPriFile *> toVisit = {&result.includedFiles};
+    while (!toVisit.isEmpty()) {
+        const QmakeIncludedPriFile *current = toVisit.takeFirst();
+        foreach (const FileName &folder, current->result.folders)
+            paths.insert(folder.toString());
+        foreach (const FileName &file, current->result.recursiveEnumerateFiles)
+            paths.insert(file.parentDir().toString());
+        foreach (const QmakeIncludedPriFile *child, current->children)
+            toVisit.append(child);
+    }
+
+    stream << qint32(paths.size());
+    foreach (const QString &path, paths) {
+        const QFileInfo fi(path);
+        stream << path << qint64(fi.lastModified().toMSecsSinceEpoch())
+               << (fi.isDir() ? qint64(-1) : qint64(fi.size()));
+    }
+}
+
+static bool checkEvalCacheDependencies(QDataStream &stream)
+{
+    qint32 count;
+    stream >> count;
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        qint64 lastModified, size;
+        stream >> path >> lastModified >> size;
+        const QFileInfo fi(path);
+        if (!fi.exists() || qint64(fi.lastModified().toMSecsSinceEpoch()) != lastModified
+                || (size != -1 && qint64(fi.size()) != size))
+            return false;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+static void writeFileNameSet(QDataStream &stream, const QSet<FileName> &files)
+{
+    stream << qint32(files.size());
+    foreach (const FileName &file, files)
+        stream << file.toString();
+}
+
+static QSet<FileName> readFileNameSet(QDataStream &stream)
+{
+    QSet<FileName> result;
+    qint32 count;
+    stream >> count;
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString file;
+        stream >> file;
+        result.insert(FileName::fromString(file));
+    }
+    return result;
+}
+
+static void writePriFileResult(QDataStream &stream, const QmakePriFileEvalResult &result)
+{
+    writeFileNameSet(stream, result.folders);
+    writeFileNameSet(stream, result.recursiveEnumerateFiles);
+    stream << qint32(result.foundFiles.size());
+    for (auto it = result.foundFiles.constBegin(); it != result.foundFiles.constEnd(); ++it) {
+        stream << static_cast<qint32>(it.key());
+        writeFileNameSet(stream, it.value());
+    }
+}
+
+static void readPriFileResult(QDataStream &stream, QmakePriFileEvalResult *result)
+{
+    result->folders = readFileNameSet(stream);
+    result->recursiveEnumerateFiles = readFileNameSet(stream);
+    qint32 count;
+    stream >> count;
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        qint32 type;
+        stream >> type;
+        result->foundFiles.insert(static_cast<FileType>(type), readFileNameSet(stream));
+    }
+}
+
+static void writePriFileTree(QDataStream &stream, const QmakeIncludedPriFile &tree)
+{
+    stream << tree.isSubDirProject << tree.name.toString();
+    writePriFileResult(stream, tree.result);
+    stream << qint32(tree.children.size());
+    foreach (const QmakeIncludedPriFile *child, tree.children)
+        writePriFileTree(stream, *child);
+}
+
+static void readPriFileTree(QDataStream &stream, QmakeIncludedPriFile *tree)
+{
+    QString name;
+    stream >> tree->isSubDirProject >> name;
+    tree->name = FileName::fromString(name);
+    readPriFileResult(stream, &tree->result);
+    qint32 count;
+    stream >> count;
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        auto child = new QmakeIncludedPriFile;
+        readPriFileTree(stream, child);
+        tree->children.insert(child->name, child);
+    }
+}
+
+static void writeEvalCache(const QmakeEvalInput &input, const QmakeEvalResult &result)
+{
+    const QString filePath = evalCacheFilePath(input);
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return;
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << EVAL_CACHE_MAGIC << EVAL_CACHE_VERSION << evalCacheFingerprint(input);
+    writeEvalCacheDependencies(stream, input, result);
+
+    stream << qint32(result.state) << qint32(result.projectType)
+           << result.subProjectsNotToDeploy;
+    writeFileNameSet(stream, result.exactSubdirs);
+    writePriFileTree(stream, result.includedFiles);
+    stream << result.targetInformation.valid << result.targetInformation.target
+           << result.targetInformation.destDir.toString()
+           << result.targetInformation.buildDir.toString()
+           << result.targetInformation.buildTarget;
+    stream << result.installsList.targetPath << qint32(result.installsList.items.size());
+    foreach (const InstallsItem &item, result.installsList.items) {
+        stream << item.path << item.active << qint32(item.files.size());
+        foreach (const ProFileEvaluator::SourceFile &source, item.files)
+            stream << source.fileName;
+    }
+    stream << qint32(result.newVarValues.size());
+    for (auto it = result.newVarValues.constBegin(); it != result.newVarValues.constEnd(); ++it)
+        stream << static_cast<qint32>(it.key()) << it.value();
+    stream << result.errors;
+}
+
+static QmakeEvalResult *readEvalCache(const QmakeEvalInput &input)
+{
+    QFile file(evalCacheFilePath(input));
+    if (!file.open(QIODevice::ReadOnly))
+        return nullptr;
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    quint32 magic, version;
+    QByteArray fingerprint;
+    stream >> magic >> version >> fingerprint;
+    if (magic != EVAL_CACHE_MAGIC || version != EVAL_CACHE_VERSION
+            || fingerprint != evalCacheFingerprint(input)
+            || !checkEvalCacheDependencies(stream))
+        return nullptr;
+
+    QScopedPointer<QmakeEvalResult> result(new QmakeEvalResult);
+    qint32 state, projectType;
+    stream >> state >> projectType >> result->subProjectsNotToDeploy;
+    result->state = static_cast<QmakeEvalResult::EvalResultState>(state);
+    result->projectType = static_cast<ProjectType>(projectType);
+    result->exactSubdirs = readFileNameSet(stream);
+    readPriFileTree(stream, &result->includedFiles);
+    QString destDir, buildDir;
+    stream >> result->targetInformation.valid >> result->targetInformation.target
+           >> destDir >> buildDir >> result->targetInformation.buildTarget;
+    result->targetInformation.destDir = FileName::fromString(destDir);
+    result->targetInformation.buildDir = FileName::fromString(buildDir);
+    qint32 itemCount;
+    stream >> result->installsList.targetPath >> itemCount;
+    for (qint32 i = 0; i < itemCount && stream.status() == QDataStream::Ok; ++i) {
+        InstallsItem item;
+        qint32 fileCount;
+        stream >> item.path >> item.active >> fileCount;
+        for (qint32 j = 0; j < fileCount && stream.status() == QDataStream::Ok; ++j) {
+            ProFileEvaluator::SourceFile source;
+            stream >> source.fileName;
+            source.proFile = nullptr;
+            item.files.append(source);
+        }
+        result->installsList.items.append(item);
+    }
+    qint32 varCount;
+    stream >> varCount;
+    for (qint32 i = 0; i < varCount && stream.status() == QDataStream::Ok; ++i) {
+        qint32 key;
+        QStringList values;
+        stream >> key >> values;
+        result->newVarValues.insert(static_cast<Variable>(key), values);
+    }
+    stream >> result->errors;
+    if (stream.status() != QDataStream::Ok)
+        return nullptr;
+    return result.take();
+}
+
 QmakeEvalResult *QmakeProFile::evaluate(const QmakeEvalInput &input)
 {
+    if (QmakeEvalResult *cached = readEvalCache(input))
+        return cached;
+
     QmakeEvalResult *result = new QmakeEvalResult;
     QtSupport::ProFileReader *exactBuildPassReader = nullptr;
     QtSupport::ProFileReader *cumulativeBuildPassReader = nullptr;
     ProFile *pro;
     if ((pro = input.readerExact->parsedProFile(input.projectFilePath.toString()))) {
-        bool exactOk = evaluateOne(input, pro, input.readerExact, false, &exactBuildPassReader);
+        // The exact and the cumulative evaluation are independent of each
+        // other: the two readers share only the parse cache, the VFS and the
+        // base environment, all of which are thread safe. Running the exact
+        // pass on an extra thread halves the evaluation time of each node,
+        // which matters most while a SUBDIRS tree is still unfolding and the
+        // thread pool is not saturated yet.
+        QFuture<bool> exactFuture = Utils::runAsync(evaluateOne, input, pro,
+                                                    input.readerExact, false,
+                                                    &exactBuildPassReader);
         bool cumulOk = evaluateOne(input, pro, input.readerCumulative, true, &cumulativeBuildPassReader);
+        bool exactOk = exactFuture.result();
         pro->deref();
         result->state = exactOk ? QmakeEvalResult::EvalOk
                                 : cumulOk ? QmakeEvalResult::EvalPartial : QmakeEvalResult::EvalFail;
@@ -1287,7 +1556,7 @@ QmakeEvalResult *QmakeProFile::evaluate(const QmakeEvalInput &input)
 
             foreach (const Utils::FileName &subDirName, subDirs) {
                 auto subDir = new QmakeIncludedPriFile;
-                subDir->proFile = nullptr;
+                subDir->isSubDirProject = true;
                 subDir->name = subDirName;
                 result->includedFiles.children.insert(subDirName, subDir);
             }
@@ -1324,7 +1593,7 @@ QmakeEvalResult *QmakeProFile::evaluate(const QmakeEvalInput &input)
             auto it = result->includedFiles.children.find(subDirName);
             if (it == result->includedFiles.children.end()) {
                 auto subDir = new QmakeIncludedPriFile;
-                subDir->proFile = nullptr;
+                subDir->isSubDirProject = true;
                 subDir->name = subDirName;
                 result->includedFiles.children.insert(subDirName, subDir);
             }
@@ -1456,6 +1725,11 @@ QmakeEvalResult *QmakeProFile::evaluate(const QmakeEvalInput &input)
         }
     }
 
+    // Only complete results are worth keeping; partial ones are re-evaluated
+    // the next time anyway.
+    if (result->state == QmakeEvalResult::EvalOk)
+        writeEvalCache(input, *result);
+
     if (exactBuildPassReader && exactBuildPassReader != input.readerExact)
         delete exactBuildPassReader;
     if (cumulativeBuildPassReader && cumulativeBuildPassReader != input.readerCumulative)
@@ -1562,7 +1836,7 @@ void QmakeProFile::applyEvaluate(QmakeEvalResult *evalResult)
             if (loop)
                 continue; // Do nothing
 
-            if (priFile->proFile) {
+            if (!priFile->isSubDirProject) {
                 QmakePriFile *qmakePriFileNode = new QmakePriFile(m_project, this, priFile->name);
                 pn->addChild(qmakePriFileNode);
                 qmakePriFileNode->setIncludedInExactParse(
@@ -216,7 +216,11 @@ QProcess *PuppetCreator::puppetProcess(const QString &puppetPath,
 {
     QProcess *puppetProcess = new QProcess;
     puppetProcess->setObjectName(puppetMode);
-    puppetProcess->setProcessEnvironment(processEnvironment());
+    /* Building the environment queries the kit and iterates over all project
+       files. It is the same for all puppet modes, so build it only once. */
+    if (m_processEnvironment.isEmpty())
+        m_processEnvironment = processEnvironment();
+    puppetProcess->setProcessEnvironment(m_processEnvironment);
 
     QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, puppetProcess, &QProcess::kill);
     QObject::connect(puppetProcess, SIGNAL(finished(int,QProcess::ExitStatus)), handlerObject, finishSlot);
@@ -342,11 +346,15 @@ void PuppetCreator::createQml2PuppetExecutableIfMissing()
     m_availablePuppetType = FallbackPuppet;
 
     if (!useOnlyFallbackPuppet()) {
-        // check if there was an already failing try to get the UserSpacePuppet
-        // -> imagine as result a FallbackPuppet and nothing will happen again
-        if (m_qml2PuppetForKitPuppetHash.value(m_kit->id(), UserSpacePuppet) == UserSpacePuppet ) {
+        // the puppet type of this kit was already determined in this session,
+        // e.g. by a previously opened document. Reuse it instead of checking the
+        // modification times again, which scans the puppet source directories.
+        if (m_qml2PuppetForKitPuppetHash.contains(m_kit->id())) {
+            m_availablePuppetType = m_qml2PuppetForKitPuppetHash.value(m_kit->id());
+        } else {
             if (checkQml2PuppetIsReady()) {
                 m_availablePuppetType = UserSpacePuppet;
+                m_qml2PuppetForKitPuppetHash.insert(m_kit->id(), m_availablePuppetType);
             } else {
                 if (m_kit->isValid()) {
                     bool buildSucceeded = build(qml2PuppetProjectFile());
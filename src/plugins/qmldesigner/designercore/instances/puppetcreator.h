@@ -116,6 +116,7 @@ protected:
 private:
     QString m_qtCreatorVersion;
     mutable QString m_compileLog;
+    mutable QProcessEnvironment m_processEnvironment;
     ProjectExplorer::Kit *m_kit;
     PuppetType m_availablePuppetType;
     static QHash<Core::Id, PuppetType> m_qml2PuppetForKitPuppetHash;
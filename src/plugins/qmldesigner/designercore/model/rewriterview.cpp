@@ -428,6 +428,13 @@ void RewriterView::amendQmlText()
 
     const QString newQmlText = m_textModifier->text();
 
+    // The model is already in sync with this text, e.g. because a change was
+    // undone within the amend delay. Skip the reparse and node sync.
+    if (newQmlText == m_lastCorrectQmlSource) {
+        emitCustomNotification(EndRewriterAmend);
+        return;
+    }
+
     ModelAmender differenceHandler(m_textToModelMerger.data());
     if (m_textToModelMerger->load(newQmlText, differenceHandler))
         m_lastCorrectQmlSource = newQmlText;
@@ -52,9 +52,11 @@
 
 #include <utils/qtcassert.h>
 
-#include <QSet>
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QLoggingCategory>
+#include <QSet>
 
 using namespace LanguageUtils;
 using namespace QmlJS;
@@ -821,15 +823,26 @@ static void removeUsedImports(QHash<QString, ImportKey> &filteredPossibleImportK
 
 static QList<QmlDesigner::Import> generatePossibleFileImports(const QString &path)
 {
+    // The scan hits the file system for every subdirectory and runs again on
+    // every text amend. Directories rarely change while editing, so the
+    // decision is cached per directory and renewed when its modification
+    // time changes.
+    static QHash<QString, QPair<QDateTime, bool> > importCandidates;
+
     QList<QmlDesigner::Import> possibleImports;
 
     foreach (const QString &subDir, QDir(path).entryList(QDir::Dirs | QDir::NoDot | QDir::NoDotDot)) {
-        QDir dir(path + "/" + subDir);
-        if (!dir.entryInfoList(QStringList("*.qml"), QDir::Files).isEmpty()
-                && dir.entryInfoList(QStringList("qmldir"), QDir::Files).isEmpty()) {
-            QmlDesigner::Import import = QmlDesigner::Import::createFileImport(subDir);
-            possibleImports.append(import);
+        const QString subDirPath = path + "/" + subDir;
+        const QDateTime lastModified = QFileInfo(subDirPath).lastModified();
+        auto candidate = importCandidates.find(subDirPath);
+        if (candidate == importCandidates.end() || candidate->first != lastModified) {
+            QDir dir(subDirPath);
+            const bool isCandidate = !dir.entryInfoList(QStringList("*.qml"), QDir::Files).isEmpty()
+                    && dir.entryInfoList(QStringList("qmldir"), QDir::Files).isEmpty();
+            candidate = importCandidates.insert(subDirPath, qMakePair(lastModified, isCandidate));
         }
+        if (candidate->second)
+            possibleImports.append(QmlDesigner::Import::createFileImport(subDir));
     }
 
     return possibleImports;
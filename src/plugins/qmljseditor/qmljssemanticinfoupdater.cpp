@@ -108,6 +108,12 @@ void SemanticInfoUpdater::run()
     }
 }
 
+bool SemanticInfoUpdater::isOutdated()
+{
+    QMutexLocker locker(&m_mutex);
+    return m_wasCancelled || m_sourceDocument;
+}
+
 QmlJSTools::SemanticInfo SemanticInfoUpdater::makeNewSemanticInfo(const QmlJS::Document::Ptr &doc, const QmlJS::Snapshot &snapshot)
 {
     using namespace QmlJS;
@@ -124,6 +130,12 @@ QmlJSTools::SemanticInfo SemanticInfoUpdater::makeNewSemanticInfo(const QmlJS::D
     ScopeChain *scopeChain = new ScopeChain(doc, semanticInfo.context);
     semanticInfo.setRootScopeChain(QSharedPointer<const ScopeChain>(scopeChain));
 
+    // linking is already expensive; if a newer revision was queued meanwhile
+    // the result of this run is discarded anyway, so don't pay for the static
+    // analysis pass on top of it
+    if (isOutdated())
+        return semanticInfo;
+
     if (doc->language() == Dialect::Json) {
         Utils::JsonSchema *schema =
                 QmlJSEditorPlugin::instance()->jsonManager()->schemaForFile(doc->fileName());
@@ -56,6 +56,7 @@ protected:
 private:
     QmlJSTools::SemanticInfo makeNewSemanticInfo(const QmlJS::Document::Ptr &doc,
                                                  const QmlJS::Snapshot &snapshot);
+    bool isOutdated();
 
 private:
     QMutex m_mutex;
@@ -70,6 +70,7 @@ void FlameGraphModel::clear()
     m_compileStack.append(QmlEvent());
     m_callStackTop = &m_stackBottom;
     m_compileStackTop = &m_stackBottom;
+    m_lookupTable.clear();
     m_typeIdsWithNotes.clear();
     endResetModel();
 }
@@ -135,11 +136,24 @@ void FlameGraphModel::loadEvent(const QmlEvent &event, const QmlEventType &type)
     QTC_CHECK(stackTop);
 }
 
+static void sortChildrenByCalls(FlameGraphData *data)
+{
+    Utils::sort(data->children, [](const FlameGraphData *a, const FlameGraphData *b) {
+        return a->calls > b->calls;
+    });
+    for (FlameGraphData *child : data->children)
+        sortChildrenByCalls(child);
+}
+
 void FlameGraphModel::finalize()
 {
     for (FlameGraphData *child : m_stackBottom.children)
         m_stackBottom.duration += child->duration;
 
+    // Sorting the siblings on every call would disturb the hot loadEvent path;
+    // once at the end is enough.
+    sortChildrenByCalls(&m_stackBottom);
+
     loadNotes(-1, false);
     endResetModel();
 }
@@ -218,24 +232,13 @@ FlameGraphData::~FlameGraphData()
 
 FlameGraphData *FlameGraphModel::pushChild(FlameGraphData *parent, const QmlEvent &data)
 {
-    QVector<FlameGraphData *> &siblings = parent->children;
-
-    for (auto it = siblings.begin(), end = siblings.end(); it != end; ++it) {
-        FlameGraphData *child = *it;
-        if (child->typeIndex == data.typeIndex()) {
-            ++child->calls;
-            for (auto back = it, front = siblings.begin(); back != front;) {
-                 --back;
-                if ((*back)->calls >= (*it)->calls)
-                    break;
-                qSwap(*it, *back);
-                it = back;
-            }
-            return child;
-        }
+    FlameGraphData *&child = m_lookupTable[qMakePair(parent, data.typeIndex())];
+    if (child) {
+        ++child->calls;
+        return child;
     }
 
-    FlameGraphData *child = new FlameGraphData(parent, data.typeIndex());
+    child = new FlameGraphData(parent, data.typeIndex());
     parent->children.append(child);
     return child;
 }
@@ -29,6 +29,8 @@
 #include "qmlprofilereventtypes.h"
 #include "qmleventlocation.h"
 
+#include <QHash>
+#include <QPair>
 #include <QSet>
 #include <QVector>
 #include <QStack>
@@ -105,6 +107,10 @@ private:
     FlameGraphData *m_callStackTop;
     FlameGraphData *m_compileStackTop;
 
+    // (parent, typeIndex) -> child, so that pushing a child while events
+    // stream in doesn't have to scan the siblings
+    QHash<QPair<FlameGraphData *, int>, FlameGraphData *> m_lookupTable;
+
     int m_modelId;
     QmlProfilerModelManager *m_modelManager;
 
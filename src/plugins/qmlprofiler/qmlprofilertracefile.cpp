@@ -37,6 +37,8 @@
 #include <QBuffer>
 #include <QDataStream>
 
+#include <functional>
+
 namespace QmlProfiler {
 namespace Internal {
 
@@ -422,7 +424,7 @@ public:
     void addEvent(const QmlEvent &event);
     void addRange(const QmlEvent &start, const QmlEvent &end);
 
-    QVector<QmlEvent> finalize();
+    void finalize(const std::function<void(const QVector<QmlEvent> &)> &sendEvents);
 
 private:
     struct QmlRange {
@@ -443,7 +445,7 @@ void EventList::addRange(const QmlEvent &start, const QmlEvent &end)
     ranges.append({start, end});
 }
 
-QVector<QmlEvent> EventList::finalize()
+void EventList::finalize(const std::function<void(const QVector<QmlEvent> &)> &sendEvents)
 {
     std::sort(ranges.begin(), ranges.end(), [](const QmlRange &a, const QmlRange &b) {
         if (a.begin.timestamp() < b.begin.timestamp())
@@ -456,11 +458,13 @@ QVector<QmlEvent> EventList::finalize()
         return (a.end.timestamp() > b.end.timestamp());
     });
 
+    // Send the merged events out in chunks. Keeping them all in an extra buffer
+    // next to the ranges would double the already high memory footprint.
+    static const int chunkSize = 4096;
+
     QList<QmlEvent> ends;
     QVector<QmlEvent> result;
     while (!ranges.isEmpty()) {
-        // This is more expensive than just iterating, but we don't want to double the already
-        // high memory footprint.
         QmlRange range = ranges.takeFirst();
         while (!ends.isEmpty() && ends.last().timestamp() <= range.begin.timestamp())
             result.append(ends.takeLast());
@@ -476,11 +480,15 @@ QVector<QmlEvent> EventList::finalize()
             }
             ends.insert(it, range.end);
         }
+        if (result.size() >= chunkSize) {
+            sendEvents(result);
+            result.clear();
+        }
     }
     while (!ends.isEmpty())
         result.append(ends.takeLast());
 
-    return result;
+    sendEvents(result);
 }
 
 void QmlProfilerFileReader::loadEvents(QXmlStreamReader &stream)
@@ -559,7 +567,9 @@ void QmlProfilerFileReader::loadEvents(QXmlStreamReader &stream)
         case QXmlStreamReader::EndElement: {
             if (elementName == _("profilerDataModel")) {
                 // done reading profilerDataModel
-                emit qmlEventsLoaded(events.finalize());
+                events.finalize([this](const QVector<QmlEvent> &chunk) {
+                    emit qmlEventsLoaded(chunk);
+                });
                 return;
             }
             break;
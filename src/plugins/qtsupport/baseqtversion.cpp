@@ -48,6 +48,7 @@
 #include <utils/synchronousprocess.h>
 #include <utils/winutils.h>
 
+#include <QDateTime>
 #include <QDir>
 #include <QUrl>
 #include <QFileInfo>
@@ -67,6 +68,8 @@ using namespace Utils;
 static const char QTVERSIONAUTODETECTED[] = "isAutodetected";
 static const char QTVERSIONAUTODETECTIONSOURCE []= "autodetectionSource";
 static const char QTVERSIONQMAKEPATH[] = "QMakePath";
+static const char QTVERSIONQUERYTIMESTAMP[] = "QMakeTimestamp";
+static const char QTVERSIONQUERYRESULTS[] = "QueryResults";
 
 static const char MKSPEC_VALUE_LIBINFIX[] = "QT_LIBINFIX";
 static const char MKSPEC_VALUE_NAMESPACE[] = "QT_NAMESPACE";
@@ -641,6 +644,22 @@ void BaseQtVersion::fromMap(const QVariantMap &map)
     }
 
     ctor(FileName::fromString(string));
+
+    // Restore the cached qmake -query results if the qmake binary has not
+    // changed since they were taken. This saves running qmake once per
+    // registered version on startup.
+    const QDateTime timestamp = m_qmakeCommand.toFileInfo().lastModified();
+    if (timestamp.isValid()
+            && map.value(QLatin1String(QTVERSIONQUERYTIMESTAMP)).toLongLong()
+               == timestamp.toMSecsSinceEpoch()) {
+        const QVariantMap query = map.value(QLatin1String(QTVERSIONQUERYRESULTS)).toMap();
+        if (!query.isEmpty()) {
+            m_versionInfo.clear();
+            for (auto it = query.constBegin(); it != query.constEnd(); ++it)
+                m_versionInfo.insert(ProKey(it.key()), ProString(it.value().toString()));
+            parseVersionInfo();
+        }
+    }
 }
 
 QVariantMap BaseQtVersion::toMap() const
@@ -652,6 +671,17 @@ QVariantMap BaseQtVersion::toMap() const
     if (isAutodetected())
         result.insert(QLatin1String(QTVERSIONAUTODETECTIONSOURCE), autodetectionSource());
     result.insert(QLatin1String(QTVERSIONQMAKEPATH), qmakeCommand().toString());
+
+    // Cache the qmake -query results, keyed by the modification time of the
+    // qmake binary.
+    const QDateTime timestamp = qmakeCommand().toFileInfo().lastModified();
+    if (m_versionInfoUpToDate && timestamp.isValid()) {
+        result.insert(QLatin1String(QTVERSIONQUERYTIMESTAMP), timestamp.toMSecsSinceEpoch());
+        QVariantMap query;
+        for (auto it = m_versionInfo.constBegin(); it != m_versionInfo.constEnd(); ++it)
+            query.insert(it.key().toQString(), it.value().toQString());
+        result.insert(QLatin1String(QTVERSIONQUERYRESULTS), query);
+    }
     return result;
 }
 
@@ -1160,10 +1190,6 @@ void BaseQtVersion::updateVersionInfo() const
 
     // extract data from qmake executable
     m_versionInfo.clear();
-    m_installed = true;
-    m_hasExamples = false;
-    m_hasDocumentation = false;
-    m_hasQmlDump = false;
 
     if (!queryQMakeVariables(qmakeCommand(), qmakeRunEnvironment(), &m_versionInfo)) {
         m_qmakeIsExecutable = false;
@@ -1173,6 +1199,17 @@ void BaseQtVersion::updateVersionInfo() const
     }
     m_qmakeIsExecutable = true;
 
+    parseVersionInfo();
+}
+
+// Computes the properties derived from the raw qmake -query results. Called
+// both after running qmake and after restoring cached query results.
+void BaseQtVersion::parseVersionInfo() const
+{
+    m_installed = true;
+    m_hasExamples = false;
+    m_hasDocumentation = false;
+    m_hasQmlDump = false;
 
     const QString qtInstallBins = qmakeProperty(m_versionInfo, "QT_INSTALL_BINS");
     const QString qtHeaderData = qmakeProperty(m_versionInfo, "QT_INSTALL_HEADERS");
@@ -247,6 +247,7 @@ private:
     void setupExpander();
     void updateSourcePath() const;
     void updateVersionInfo() const;
+    void parseVersionInfo() const;
     enum Binaries { QmlViewer, QmlScene, Designer, Linguist, Uic, QScxmlc };
     QString findQtBinary(Binaries binary) const;
     void updateMkspec() const;
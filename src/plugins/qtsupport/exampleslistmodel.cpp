@@ -40,6 +40,7 @@
 #include <utils/algorithm.h>
 #include <utils/environment.h>
 #include <utils/qtcassert.h>
+#include <utils/runextensions.h>
 
 #include <algorithm>
 
@@ -284,8 +285,8 @@ static bool isValidExampleOrDemo(ExampleItem &item)
     return ok || debugExamples();
 }
 
-void ExamplesListModel::parseExamples(QXmlStreamReader *reader,
-    const QString &projectsOffset, const QString &examplesInstallPath)
+static void parseExamples(QXmlStreamReader *reader, const QString &projectsOffset,
+                          const QString &examplesInstallPath, QList<ExampleItem> *items)
 {
     ExampleItem item;
     const QChar slash = QLatin1Char('/');
@@ -326,7 +327,7 @@ void ExamplesListModel::parseExamples(QXmlStreamReader *reader,
         case QXmlStreamReader::EndElement:
             if (reader->name() == QLatin1String("example")) {
                 if (isValidExampleOrDemo(item))
-                    m_exampleItems.append(item);
+                    items->append(item);
             } else if (reader->name() == QLatin1String("examples")) {
                 return;
             }
@@ -337,8 +338,8 @@ void ExamplesListModel::parseExamples(QXmlStreamReader *reader,
     }
 }
 
-void ExamplesListModel::parseDemos(QXmlStreamReader *reader,
-    const QString &projectsOffset, const QString &demosInstallPath)
+static void parseDemos(QXmlStreamReader *reader, const QString &projectsOffset,
+                       const QString &demosInstallPath, QList<ExampleItem> *items)
 {
     ExampleItem item;
     const QChar slash = QLatin1Char('/');
@@ -370,7 +371,7 @@ void ExamplesListModel::parseDemos(QXmlStreamReader *reader,
         case QXmlStreamReader::EndElement:
             if (reader->name() == QLatin1String("demo")) {
                 if (isValidExampleOrDemo(item))
-                    m_exampleItems.append(item);
+                    items->append(item);
             } else if (reader->name() == QLatin1String("demos")) {
                 return;
             }
@@ -381,7 +382,8 @@ void ExamplesListModel::parseDemos(QXmlStreamReader *reader,
     }
 }
 
-void ExamplesListModel::parseTutorials(QXmlStreamReader *reader, const QString &projectsOffset)
+static void parseTutorials(QXmlStreamReader *reader, const QString &projectsOffset,
+                           QList<ExampleItem> *items)
 {
     ExampleItem item;
     const QChar slash = QLatin1Char('/');
@@ -414,7 +416,7 @@ void ExamplesListModel::parseTutorials(QXmlStreamReader *reader, const QString &
             break;
         case QXmlStreamReader::EndElement:
             if (reader->name() == QLatin1String("tutorial"))
-                m_exampleItems.append(item);
+                items->append(item);
             else if (reader->name() == QLatin1String("tutorials"))
                 return;
             break;
@@ -424,15 +426,11 @@ void ExamplesListModel::parseTutorials(QXmlStreamReader *reader, const QString &
     }
 }
 
-void ExamplesListModel::updateExamples()
+static QList<ExampleItem> parseExampleSources(const QStringList &sources,
+                                              const QString &examplesInstallPath,
+                                              const QString &demosInstallPath)
 {
-    QString examplesInstallPath;
-    QString demosInstallPath;
-
-    QStringList sources = m_exampleSetModel.exampleSources(&examplesInstallPath, &demosInstallPath);
-
-    beginResetModel();
-    m_exampleItems.clear();
+    QList<ExampleItem> items;
 
     foreach (const QString &exampleSource, sources) {
         QFile exampleFile(exampleSource);
@@ -454,11 +452,11 @@ void ExamplesListModel::updateExamples()
             switch (reader.readNext()) {
             case QXmlStreamReader::StartElement:
                 if (reader.name() == QLatin1String("examples"))
-                    parseExamples(&reader, examplesDir.path(), examplesInstallPath);
+                    parseExamples(&reader, examplesDir.path(), examplesInstallPath, &items);
                 else if (reader.name() == QLatin1String("demos"))
-                    parseDemos(&reader, demosDir.path(), demosInstallPath);
+                    parseDemos(&reader, demosDir.path(), demosInstallPath, &items);
                 else if (reader.name() == QLatin1String("tutorials"))
-                    parseTutorials(&reader, examplesDir.path());
+                    parseTutorials(&reader, examplesDir.path(), &items);
                 break;
             default: // nothing
                 break;
@@ -467,7 +465,34 @@ void ExamplesListModel::updateExamples()
         if (reader.hasError() && debugExamples())
             qWarning() << QString::fromLatin1("ERROR: Could not parse file as XML document (%1)").arg(exampleSource);
     }
-    endResetModel();
+
+    return items;
+}
+
+void ExamplesListModel::updateExamples()
+{
+    QString examplesInstallPath;
+    QString demosInstallPath;
+
+    const QStringList sources = m_exampleSetModel.exampleSources(&examplesInstallPath,
+                                                                 &demosInstallPath);
+
+    // Parsing the manifests stats the file system for every example to
+    // resolve its project and files to open, which takes noticeable time
+    // with several Qt versions installed. Do it in a worker and reset the
+    // model once the result arrives.
+    const int updateId = ++m_updateId;
+    QFuture<QList<ExampleItem>> future
+            = Utils::runAsync([sources, examplesInstallPath, demosInstallPath] {
+        return parseExampleSources(sources, examplesInstallPath, demosInstallPath);
+    });
+    Utils::onResultReady(future, this, [this, updateId](const QList<ExampleItem> &items) {
+        if (updateId != m_updateId)
+            return; // another update was started in the meantime
+        beginResetModel();
+        m_exampleItems = items;
+        endResetModel();
+    });
 }
 
 void ExampleSetModel::updateQtVersionList()
@@ -31,7 +31,6 @@
 #include <QSortFilterProxyModel>
 #include <QStandardItemModel>
 #include <QStringList>
-#include <QXmlStreamReader>
 
 namespace QtSupport {
 namespace Internal {
@@ -141,14 +140,9 @@ signals:
 private:
     void updateSelectedQtVersion();
 
-    void parseExamples(QXmlStreamReader *reader, const QString &projectsOffset,
-                                     const QString &examplesInstallPath);
-    void parseDemos(QXmlStreamReader *reader, const QString &projectsOffset,
-                                  const QString &demosInstallPath);
-    void parseTutorials(QXmlStreamReader *reader, const QString &projectsOffset);
-
     ExampleSetModel m_exampleSetModel;
     QList<ExampleItem> m_exampleItems;
+    int m_updateId = 0; // invalidates pending parse results on a new update
 };
 
 class ExamplesListModelFilter : public QSortFilterProxyModel
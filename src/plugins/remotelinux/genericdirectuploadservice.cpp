@@ -35,6 +35,7 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QList>
+#include <QSet>
 #include <QString>
 
 using namespace ProjectExplorer;
@@ -61,6 +62,7 @@ public:
     SshRemoteProcess::Ptr mkdirProc;
     SshRemoteProcess::Ptr lnProc;
     SshRemoteProcess::Ptr chmodProc;
+    QStringList remoteFilesToChmod;
     QList<DeployableFile> deployableFiles;
 };
 
@@ -119,6 +121,7 @@ void GenericDirectUploadService::doDeploy()
 {
     QTC_ASSERT(d->state == Inactive, setFinished(); return);
 
+    d->remoteFilesToChmod.clear();
     d->uploader = connection()->createSftpChannel();
     connect(d->uploader.data(), &SftpChannel::initialized,
             this, &GenericDirectUploadService::handleSftpInitialized);
@@ -142,7 +145,42 @@ void GenericDirectUploadService::handleSftpInitialized()
     connect(d->uploader.data(), &SftpChannel::finished,
             this, &GenericDirectUploadService::handleUploadFinished);
     d->state = Uploading;
-    uploadNextFile();
+    createRemoteDirectories();
+}
+
+void GenericDirectUploadService::createRemoteDirectories()
+{
+    // Creating all target directories with a single remote command saves one
+    // process round trip per file, which dominates deployment time for
+    // projects consisting of many small files.
+    QSet<QString> remoteDirs;
+    foreach (const DeployableFile &df, d->filesToUpload) {
+        if (df.remoteDirectory().isEmpty())
+            continue;
+        const QFileInfo fi = df.localFilePath().toFileInfo();
+        if (fi.isDir())
+            remoteDirs << df.remoteDirectory() + QLatin1Char('/') + fi.fileName();
+        else
+            remoteDirs << df.remoteDirectory();
+    }
+    if (remoteDirs.isEmpty()) {
+        uploadNextFile();
+        return;
+    }
+
+    QString command = QLatin1String("mkdir -p");
+    foreach (const QString &dir, remoteDirs)
+        command += QLatin1Char(' ') + Utils::QtcProcess::quoteArgUnix(dir);
+    d->mkdirProc = connection()->createRemoteProcess(command.toUtf8());
+    connect(d->mkdirProc.data(), &SshRemoteProcess::closed,
+            this, &GenericDirectUploadService::handleMkdirFinished);
+    connect(d->mkdirProc.data(), &SshRemoteProcess::readyReadStandardOutput,
+            this, &GenericDirectUploadService::handleStdOutData);
+    connect(d->mkdirProc.data(), &SshRemoteProcess::readyReadStandardError,
+            this, &GenericDirectUploadService::handleStdErrData);
+    connect(d->mkdirProc.data(), &SshRemoteProcess::readChannelFinished,
+            this, &GenericDirectUploadService::handleReadChannelFinished);
+    d->mkdirProc->start();
 }
 
 void GenericDirectUploadService::handleSftpChannelError(const QString &message)
@@ -181,22 +219,9 @@ void GenericDirectUploadService::handleUploadFinished(SftpJobId jobId, const QSt
         saveDeploymentTimeStamp(df);
 
         // This is done for Windows.
-        if (df.isExecutable()) {
-            const QString command = QLatin1String("chmod a+x ")
-                    + Utils::QtcProcess::quoteArgUnix(df.remoteFilePath());
-            d->chmodProc = connection()->createRemoteProcess(command.toUtf8());
-            connect(d->chmodProc.data(), &SshRemoteProcess::closed,
-                    this, &GenericDirectUploadService::handleChmodFinished);
-            connect(d->chmodProc.data(), &SshRemoteProcess::readyReadStandardOutput,
-                    this, &GenericDirectUploadService::handleStdOutData);
-            connect(d->chmodProc.data(), &SshRemoteProcess::readyReadStandardError,
-                    this, &GenericDirectUploadService::handleStdErrData);
-            connect(d->chmodProc.data(), &SshRemoteProcess::readChannelFinished,
-                    this, &GenericDirectUploadService::handleReadChannelFinished);
-            d->chmodProc->start();
-        } else {
-            uploadNextFile();
-        }
+        if (df.isExecutable())
+            d->remoteFilesToChmod << df.remoteFilePath();
+        uploadNextFile();
     }
 }
 
@@ -238,7 +263,9 @@ void GenericDirectUploadService::handleChmodFinished(int exitStatus)
         handleDeploymentDone();
         return;
     }
-    uploadNextFile();
+    emit progressMessage(tr("All files successfully deployed."));
+    setFinished();
+    handleDeploymentDone();
 }
 
 void GenericDirectUploadService::handleMkdirFinished(int exitStatus)
@@ -248,56 +275,16 @@ void GenericDirectUploadService::handleMkdirFinished(int exitStatus)
     if (d->stopRequested) {
         setFinished();
         handleDeploymentDone();
+        return;
     }
 
-    const DeployableFile &df = d->filesToUpload.first();
-    QFileInfo fi = df.localFilePath().toFileInfo();
-    const QString nativePath = df.localFilePath().toUserOutput();
     if (exitStatus != SshRemoteProcess::NormalExit || d->mkdirProc->exitCode() != 0) {
-        emit errorMessage(tr("Failed to upload file \"%1\".").arg(nativePath));
+        emit errorMessage(tr("Failed to create remote directories."));
         setFinished();
         handleDeploymentDone();
-    } else if (fi.isDir()) {
-        saveDeploymentTimeStamp(df);
-        d->filesToUpload.removeFirst();
-        uploadNextFile();
-    } else {
-        const QString remoteFilePath = df.remoteDirectory() + QLatin1Char('/')  + fi.fileName();
-        if (fi.isSymLink()) {
-             const QString target = fi.dir().relativeFilePath(fi.symLinkTarget()); // see QTBUG-5817.
-             const QStringList args = QStringList() << QLatin1String("ln") << QLatin1String("-sf")
-                                                    << target << remoteFilePath;
-             const QString command = Utils::QtcProcess::joinArgs(args, Utils::OsTypeLinux);
-
-             // See comment in SftpChannel::createLink as to why we can't use it.
-             d->lnProc = connection()->createRemoteProcess(command.toUtf8());
-             connect(d->lnProc.data(), &SshRemoteProcess::closed,
-                     this, &GenericDirectUploadService::handleLnFinished);
-             connect(d->lnProc.data(), &SshRemoteProcess::readyReadStandardOutput,
-                     this, &GenericDirectUploadService::handleStdOutData);
-             connect(d->lnProc.data(), &SshRemoteProcess::readyReadStandardError,
-                     this, &GenericDirectUploadService::handleStdErrData);
-             connect(d->lnProc.data(), &SshRemoteProcess::readChannelFinished,
-                     this, &GenericDirectUploadService::handleReadChannelFinished);
-             d->lnProc->start();
-        } else {
-            const SftpJobId job = d->uploader->uploadFile(df.localFilePath().toString(),
-                    remoteFilePath, SftpOverwriteExisting);
-            if (job == SftpInvalidJob) {
-                const QString message = tr("Failed to upload file \"%1\": "
-                                           "Could not open for reading.").arg(nativePath);
-                if (d->ignoreMissingFiles) {
-                    emit warningMessage(message);
-                    d->filesToUpload.removeFirst();
-                    uploadNextFile();
-                } else {
-                    emit errorMessage(message);
-                    setFinished();
-                    handleDeploymentDone();
-                }
-            }
-        }
+        return;
     }
+    uploadNextFile();
 }
 
 void GenericDirectUploadService::handleStdOutData()
@@ -357,6 +344,8 @@ void GenericDirectUploadService::setFinished()
         disconnect(d->mkdirProc.data(), 0, this, 0);
     if (d->lnProc)
         disconnect(d->lnProc.data(), 0, this, 0);
+    if (d->chmodProc)
+        disconnect(d->chmodProc.data(), 0, this, 0);
     if (d->uploader) {
         disconnect(d->uploader.data(), 0, this, 0);
         d->uploader->closeChannel();
@@ -366,15 +355,12 @@ void GenericDirectUploadService::setFinished()
 void GenericDirectUploadService::uploadNextFile()
 {
     if (d->filesToUpload.isEmpty()) {
-        emit progressMessage(tr("All files successfully deployed."));
-        setFinished();
-        handleDeploymentDone();
+        chmodRemoteFiles();
         return;
     }
 
     const DeployableFile &df = d->filesToUpload.first();
-    QString dirToCreate = df.remoteDirectory();
-    if (dirToCreate.isEmpty()) {
+    if (df.remoteDirectory().isEmpty()) {
         emit warningMessage(tr("Warning: No remote path set for local file \"%1\". Skipping upload.")
             .arg(df.localFilePath().toUserOutput()));
         d->filesToUpload.takeFirst();
@@ -382,23 +368,80 @@ void GenericDirectUploadService::uploadNextFile()
         return;
     }
 
-    QFileInfo fi = df.localFilePath().toFileInfo();
-    if (fi.isDir())
-        dirToCreate += QLatin1Char('/') + fi.fileName();
-    const QString command = QLatin1String("mkdir -p ")
-            + Utils::QtcProcess::quoteArgUnix(dirToCreate);
-    d->mkdirProc = connection()->createRemoteProcess(command.toUtf8());
-    connect(d->mkdirProc.data(), &SshRemoteProcess::closed,
-            this, &GenericDirectUploadService::handleMkdirFinished);
-    connect(d->mkdirProc.data(), &SshRemoteProcess::readyReadStandardOutput,
+    const QFileInfo fi = df.localFilePath().toFileInfo();
+    const QString nativePath = df.localFilePath().toUserOutput();
+    emit progressMessage(tr("Uploading file \"%1\"...").arg(nativePath));
+
+    if (fi.isDir()) {
+        // The remote directory was already created up front.
+        saveDeploymentTimeStamp(df);
+        d->filesToUpload.removeFirst();
+        uploadNextFile();
+        return;
+    }
+
+    const QString remoteFilePath = df.remoteDirectory() + QLatin1Char('/')  + fi.fileName();
+    if (fi.isSymLink()) {
+         const QString target = fi.dir().relativeFilePath(fi.symLinkTarget()); // see QTBUG-5817.
+         const QStringList args = QStringList() << QLatin1String("ln") << QLatin1String("-sf")
+                                                << target << remoteFilePath;
+         const QString command = Utils::QtcProcess::joinArgs(args, Utils::OsTypeLinux);
+
+         // See comment in SftpChannel::createLink as to why we can't use it.
+         d->lnProc = connection()->createRemoteProcess(command.toUtf8());
+         connect(d->lnProc.data(), &SshRemoteProcess::closed,
+                 this, &GenericDirectUploadService::handleLnFinished);
+         connect(d->lnProc.data(), &SshRemoteProcess::readyReadStandardOutput,
+                 this, &GenericDirectUploadService::handleStdOutData);
+         connect(d->lnProc.data(), &SshRemoteProcess::readyReadStandardError,
+                 this, &GenericDirectUploadService::handleStdErrData);
+         connect(d->lnProc.data(), &SshRemoteProcess::readChannelFinished,
+                 this, &GenericDirectUploadService::handleReadChannelFinished);
+         d->lnProc->start();
+    } else {
+        const SftpJobId job = d->uploader->uploadFile(df.localFilePath().toString(),
+                remoteFilePath, SftpOverwriteExisting);
+        if (job == SftpInvalidJob) {
+            const QString message = tr("Failed to upload file \"%1\": "
+                                       "Could not open for reading.").arg(nativePath);
+            if (d->ignoreMissingFiles) {
+                emit warningMessage(message);
+                d->filesToUpload.removeFirst();
+                uploadNextFile();
+            } else {
+                emit errorMessage(message);
+                setFinished();
+                handleDeploymentDone();
+            }
+        }
+    }
+}
+
+void GenericDirectUploadService::chmodRemoteFiles()
+{
+    if (d->remoteFilesToChmod.isEmpty()) {
+        emit progressMessage(tr("All files successfully deployed."));
+        setFinished();
+        handleDeploymentDone();
+        return;
+    }
+
+    // As with the directory creation above, one command for all executables
+    // instead of one per file.
+    QString command = QLatin1String("chmod a+x");
+    foreach (const QString &remoteFilePath, d->remoteFilesToChmod)
+        command += QLatin1Char(' ') + Utils::QtcProcess::quoteArgUnix(remoteFilePath);
+    d->remoteFilesToChmod.clear();
+    d->chmodProc = connection()->createRemoteProcess(command.toUtf8());
+    connect(d->chmodProc.data(), &SshRemoteProcess::closed,
+            this, &GenericDirectUploadService::handleChmodFinished);
+    connect(d->chmodProc.data(), &SshRemoteProcess::readyReadStandardOutput,
             this, &GenericDirectUploadService::handleStdOutData);
-    connect(d->mkdirProc.data(), &SshRemoteProcess::readyReadStandardError,
+    connect(d->chmodProc.data(), &SshRemoteProcess::readyReadStandardError,
             this, &GenericDirectUploadService::handleStdErrData);
-    connect(d->mkdirProc.data(), &SshRemoteProcess::readChannelFinished,
+    connect(d->chmodProc.data(), &SshRemoteProcess::readChannelFinished,
             this, &GenericDirectUploadService::handleReadChannelFinished);
-    emit progressMessage(tr("Uploading file \"%1\"...")
-        .arg(df.localFilePath().toUserOutput()));
-    d->mkdirProc->start();
+    d->chmodProc->start();
 }
 
 } //namespace RemoteLinux
@@ -72,7 +72,9 @@ private:
 
     void checkDeploymentNeeded(const ProjectExplorer::DeployableFile &file) const;
     void setFinished();
+    void createRemoteDirectories();
     void uploadNextFile();
+    void chmodRemoteFiles();
 
     Internal::GenericDirectUploadServicePrivate * const d;
 };
@@ -310,10 +310,14 @@ bool TarPackageCreationStep::appendFile(QFile &tarFile, const QFileInfo &fileInf
     emit addOutput(tr("Adding file \"%1\" to tarball...").arg(nativePath),
                    OutputFormat::NormalMessage);
 
-    // TODO: Wasteful. Work with fixed-size buffer.
+    // Copy the file through a fixed-size buffer instead of allocating
+    // a new byte array for every chunk.
+    QByteArray buffer(chunkSize, Qt::Uninitialized);
     while (!file.atEnd() && file.error() == QFile::NoError && tarFile.error() == QFile::NoError) {
-        const QByteArray data = file.read(chunkSize);
-        tarFile.write(data);
+        const qint64 bytesRead = file.read(buffer.data(), buffer.size());
+        if (bytesRead <= 0)
+            break;
+        tarFile.write(buffer.constData(), bytesRead);
         if (fi.isCanceled())
             return false;
     }
@@ -40,6 +40,7 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QDebug>
+#include <QHash>
 
 using namespace Core;
 using namespace ProjectExplorer;
@@ -304,6 +305,10 @@ void ResourceTopLevelNode::addInternalNodes()
 
     QMap<PrefixFolderLang, FolderNode *> folderNodes;
 
+    // Resolved once up front; constructing it anew for each of the possibly
+    // thousands of entries shows up in the profile for big resource files.
+    const QDir baseDir = filePath().toFileInfo().absoluteDir();
+
     int prfxcount = file.prefixCount();
     for (int i = 0; i < prfxcount; ++i) {
         const QString &prefix = file.prefix(i);
@@ -330,7 +335,7 @@ void ResourceTopLevelNode::addInternalNodes()
 
             QString alias = file.alias(i, j);
             if (alias.isEmpty())
-                alias = filePath().toFileInfo().absoluteDir().relativeFilePath(fileName);
+                alias = baseDir.relativeFilePath(fileName);
 
             QString prefixWithSlash = prefix;
             if (!prefixWithSlash.endsWith(QLatin1Char('/')))
@@ -352,8 +357,7 @@ void ResourceTopLevelNode::addInternalNodes()
                 folderId = PrefixFolderLang(prefix, folderName, lang);
                 if (!folderNodes.contains(folderId)) {
                     const QString absoluteFolderName
-                            = filePath().toFileInfo().absoluteDir().absoluteFilePath(
-                                currentPathList.join(QLatin1Char('/')));
+                            = baseDir.absoluteFilePath(currentPathList.join(QLatin1Char('/')));
                     const FileName folderPath = FileName::fromString(absoluteFolderName);
                     FolderNode *newNode
                             = new SimpleResourceFolderNode(folderName, pathElement,
@@ -655,8 +659,23 @@ ResourceTopLevelNode *ResourceFolderNode::resourceNode() const
     return m_topLevelNode;
 }
 
+static FileType fileTypeForResource(const FileName &filePath)
+{
+    // Resource trees contain thousands of files sharing a handful of
+    // suffixes, and the mime check behind fileTypeForFileName() is paid per
+    // file. The match is by extension only, so its result can be shared.
+    static QHash<QString, FileType> typesBySuffix;
+    const QString suffix = filePath.toFileInfo().suffix().toLower();
+    const auto it = typesBySuffix.constFind(suffix);
+    if (it != typesBySuffix.constEnd())
+        return it.value();
+    const FileType type = FileNode::fileTypeForFileName(filePath);
+    typesBySuffix.insert(suffix, type);
+    return type;
+}
+
 ResourceFileNode::ResourceFileNode(const FileName &filePath, const QString &qrcPath, const QString &displayName)
-    : FileNode(filePath, FileNode::fileTypeForFileName(filePath), false)
+    : FileNode(filePath, fileTypeForResource(filePath), false)
     , m_qrcPath(qrcPath)
     , m_displayName(displayName)
 {
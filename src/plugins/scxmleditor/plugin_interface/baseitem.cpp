@@ -285,7 +285,12 @@ QRectF BaseItem::boundingRect() const
 
 void BaseItem::setTag(ScxmlTag *tag)
 {
-    m_tag = tag;
+    if (m_tag != tag) {
+        // keep the tag-to-item index of the scene in sync
+        if (m_scene)
+            m_scene->childTagChanged(this, m_tag, tag);
+        m_tag = tag;
+    }
 }
 
 void BaseItem::init(ScxmlTag *tag, BaseItem *parentItem, bool /*initChildren*/, bool /*blockUpdates*/)
@@ -469,22 +469,18 @@ void GraphicsScene::endTagChange(ScxmlDocument::TagChange change, ScxmlTag *tag,
 
     switch (change) {
     case ScxmlDocument::TagAttributesChanged: {
-        foreach (BaseItem *item, m_baseItems) {
-            if (item->tag() == tag)
-                item->updateAttributes();
-        }
+        foreach (BaseItem *item, m_itemsByTag.values(tag))
+            item->updateAttributes();
         break;
     }
     case ScxmlDocument::TagEditorInfoChanged: {
-        foreach (BaseItem *item, m_baseItems) {
-            if (item->tag() == tag)
-                item->updateEditorInfo();
-        }
+        foreach (BaseItem *item, m_itemsByTag.values(tag))
+            item->updateEditorInfo();
         break;
     }
     case ScxmlDocument::TagCurrentChanged: {
-        foreach (BaseItem *item, m_baseItems) {
-            if (!item->isSelected() && item->tag() == tag)
+        foreach (BaseItem *item, m_itemsByTag.values(tag)) {
+            if (!item->isSelected())
                 item->setSelected(true);
         }
         checkPaste();
@@ -717,23 +713,14 @@ BaseItem *GraphicsScene::findItem(const ScxmlTag *tag) const
     if (!tag)
         return nullptr;
 
-    foreach (BaseItem *it, m_baseItems) {
-        if (it->tag() == tag)
-            return it;
-    }
-
-    return nullptr;
+    return m_itemsByTag.value(tag);
 }
 
 void GraphicsScene::removeItems(const ScxmlTag *tag)
 {
     if (tag) {
         // Find right items
-        QVector<BaseItem*> items;
-        foreach (BaseItem *it, m_baseItems) {
-            if (it->tag() == tag)
-                items << it;
-        }
+        const QList<BaseItem*> items = m_itemsByTag.values(tag);
 
         // Then delete them
         for (int i = items.count(); i--;) {
@@ -897,18 +884,30 @@ void GraphicsScene::addChild(BaseItem *item)
             openStateView(item);
         }, Qt::QueuedConnection);
         m_baseItems << item;
+        if (item->tag())
+            m_itemsByTag.insert(item->tag(), item);
     }
 }
 
 void GraphicsScene::removeChild(BaseItem *item)
 {
-    if (item)
+    if (item) {
         disconnect(item, 0, this, 0);
+        m_itemsByTag.remove(item->tag(), item);
+    }
     m_baseItems.removeAll(item);
 
     selectionChanged(false);
 }
 
+void GraphicsScene::childTagChanged(BaseItem *item, ScxmlTag *oldTag, ScxmlTag *newTag)
+{
+    if (oldTag)
+        m_itemsByTag.remove(oldTag, item);
+    if (newTag)
+        m_itemsByTag.insert(newTag, item);
+}
+
 void GraphicsScene::checkItemsVisibility(double scaleFactor)
 {
     foreach (BaseItem *item, m_baseItems) {
@@ -30,6 +30,7 @@
 
 #include <QGraphicsLineItem>
 #include <QGraphicsScene>
+#include <QHash>
 
 QT_FORWARD_DECLARE_CLASS(QAction)
 QT_FORWARD_DECLARE_CLASS(QKeyEvent)
@@ -125,6 +126,7 @@ private:
     void removeItems(const ScxmlTag *tag);
     void addChild(BaseItem *item);
     void removeChild(BaseItem *item);
+    void childTagChanged(BaseItem *item, ScxmlTag *oldTag, ScxmlTag *newTag);
     void addWarningItem(WarningItem *item);
     void removeWarningItem(WarningItem *item);
     void connectDocument();
@@ -135,6 +137,9 @@ private:
     QPointer<ScxmlUiFactory> m_uiFactory;
     QPointer<ScxmlDocument> m_document;
     QVector<BaseItem*> m_baseItems;
+    // Index of m_baseItems by tag, kept up to date by addChild/removeChild
+    // and BaseItem::setTag; avoids scanning all items per document change
+    QMultiHash<const ScxmlTag*, BaseItem*> m_itemsByTag;
     QVector<WarningItem*> m_allWarnings;
     int m_pasteCounter = 0;
     QPointer<BaseItem> m_lastPasteTargetItem;
@@ -956,6 +956,8 @@ bool SubversionPlugin::vcsAdd(const QString &workingDir, const QString &rawFileN
     const SubversionResponse response
             = runSvn(workingDir, args, m_client->vcsTimeoutS(),
                      VcsCommand::SshPasswordPrompt | VcsCommand::ShowStdOut);
+    if (!response.error)
+        m_statusCache.clear();
     return !response.error;
 }
 
@@ -971,6 +973,8 @@ bool SubversionPlugin::vcsDelete(const QString &workingDir, const QString &rawFi
     const SubversionResponse response
             = runSvn(workingDir, args, m_client->vcsTimeoutS(),
                      VcsCommand::SshPasswordPrompt | VcsCommand::ShowStdOut);
+    if (!response.error)
+        m_statusCache.clear();
     return !response.error;
 }
 
@@ -984,6 +988,8 @@ bool SubversionPlugin::vcsMove(const QString &workingDir, const QString &from, c
             = runSvn(workingDir, args, m_client->vcsTimeoutS(),
                      VcsCommand::SshPasswordPrompt | VcsCommand::ShowStdOut
                      | VcsCommand::FullySynchronously);
+    if (!response.error)
+        m_statusCache.clear();
     return !response.error;
 }
 
@@ -1040,13 +1046,47 @@ bool SubversionPlugin::managesDirectory(const QString &directory, QString *topLe
 
 bool SubversionPlugin::managesFile(const QString &workingDirectory, const QString &fileName) const
 {
-    QStringList args;
-    args << QLatin1String("status");
-    args << SubversionClient::addAuthenticationOptions(client()->settings())
-         << QDir::toNativeSeparators(SubversionClient::escapeFile(fileName));
-    SubversionResponse response
-            = runSvn(workingDirectory, args, m_client->vcsTimeoutS(), 0);
-    return response.stdOut.isEmpty() || response.stdOut.at(0) != QLatin1Char('?');
+    // Querying one file per "svn status" run makes opening many files crawl
+    // on slow working copies. Harvest the whole working directory once
+    // instead: the recursive status lists the unversioned entries, so a file
+    // is managed unless it appears there or lies below an unversioned
+    // directory. The cache ages out quickly to pick up external changes.
+    enum { statusCacheTimeoutS = 10 };
+
+    StatusCacheEntry &entry = m_statusCache[workingDirectory];
+    if (!entry.timeStamp.isValid()
+            || entry.timeStamp.secsTo(QDateTime::currentDateTime()) > statusCacheTimeoutS) {
+        QStringList args;
+        args << QLatin1String("status");
+        args << SubversionClient::addAuthenticationOptions(client()->settings());
+        const SubversionResponse response
+                = runSvn(workingDirectory, args, m_client->vcsTimeoutS(), 0);
+        if (response.error) {
+            // Do not cache failed runs; an empty response counted as managed before.
+            m_statusCache.remove(workingDirectory);
+            return true;
+        }
+        entry.unversioned.clear();
+        foreach (const QString &l, response.stdOut.split(QLatin1Char('\n'), QString::SkipEmptyParts)) {
+            const QString line = l.trimmed();
+            if (line.size() > 8 && line.startsWith(QLatin1Char('?')))
+                entry.unversioned.insert(QDir::fromNativeSeparators(line.mid(7).trimmed()));
+        }
+        entry.timeStamp = QDateTime::currentDateTime();
+    }
+
+    // An unversioned directory hides everything below it, so check the
+    // parent directories as well.
+    QString path = QDir::fromNativeSeparators(fileName);
+    while (!path.isEmpty()) {
+        if (entry.unversioned.contains(path))
+            return false;
+        const int slashIndex = path.lastIndexOf(QLatin1Char('/'));
+        if (slashIndex < 0)
+            break;
+        path.truncate(slashIndex);
+    }
+    return true;
 }
 
 // Check whether SVN management subdirs exist.
@@ -28,6 +28,10 @@
 #include "subversionsettings.h"
 
 #include <vcsbase/vcsbaseplugin.h>
+
+#include <QDateTime>
+#include <QHash>
+#include <QSet>
 #include <QStringList>
 
 QT_BEGIN_NAMESPACE
@@ -146,6 +150,17 @@ private:
 
     const QStringList m_svnDirectories;
 
+    // One recursive "svn status" run serves all managed-file queries for a
+    // working directory until the entry ages out or a VCS operation changes
+    // the set of versioned files.
+    class StatusCacheEntry
+    {
+    public:
+        QDateTime timeStamp;
+        QSet<QString> unversioned;
+    };
+    mutable QHash<QString, StatusCacheEntry> m_statusCache;
+
     SubversionClient *m_client = nullptr;
     QString m_commitMessageFileName;
     QString m_commitRepository;
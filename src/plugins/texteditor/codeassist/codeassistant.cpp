@@ -25,6 +25,7 @@
 
 #include "codeassistant.h"
 #include "completionassistprovider.h"
+#include "completionusage.h"
 #include "quickfixassistprovider.h"
 #include "iassistprocessor.h"
 #include "textdocument.h"
@@ -350,6 +351,7 @@ void CodeAssistantPrivate::displayProposal(IAssistProposal *newProposal, AssistR
 void CodeAssistantPrivate::processProposalItem(AssistProposalItemInterface *proposalItem)
 {
     QTC_ASSERT(m_proposal, return);
+    CompletionUsage::recordAcceptance(proposalItem->text());
     TextDocumentManipulator manipulator(m_editorWidget);
     proposalItem->apply(manipulator, m_proposal->basePosition());
     destroyContext();
@@ -0,0 +1,60 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt Creator.
+**
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+****************************************************************************/
+
+#include "completionusage.h"
+
+#include <QHash>
+
+using namespace TextEditor::Internal;
+
+namespace {
+
+// Keeps the table bounded on long sessions; by the time the limit is hit
+// the frequently used items are tracked already.
+enum { MaxTrackedProposals = 10000 };
+
+QHash<QString, int> &acceptances()
+{
+    static QHash<QString, int> table;
+    return table;
+}
+
+} // Anonymous
+
+void CompletionUsage::recordAcceptance(const QString &text)
+{
+    if (text.isEmpty())
+        return;
+
+    QHash<QString, int> &table = acceptances();
+    if (table.size() >= MaxTrackedProposals && !table.contains(text))
+        return;
+    ++table[text];
+}
+
+int CompletionUsage::acceptanceCount(const QString &text)
+{
+    return acceptances().value(text);
+}
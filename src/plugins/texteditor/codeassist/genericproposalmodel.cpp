@@ -26,6 +26,7 @@
 #include "genericproposalmodel.h"
 
 #include "assistproposalitem.h"
+#include "completionusage.h"
 #include <texteditor/texteditorsettings.h>
 #include <texteditor/completionsettings.h>
 
@@ -72,6 +73,11 @@ struct ContentLessThan
         if (a->order() != b->order())
             return a->order() > b->order();
 
+        // Among equally ranked items, the ones accepted before come first.
+        if (int diff = Internal::CompletionUsage::acceptanceCount(a->text())
+                - Internal::CompletionUsage::acceptanceCount(b->text()))
+            return diff > 0;
+
         if (lowera == lowerb)
             return lessThan(a->text(), b->text());
         else
@@ -142,8 +148,8 @@ void GenericProposalModel::loadContent(const QList<AssistProposalItemInterface *
     m_originalItems = items;
     m_currentItems = items;
     m_duplicatesRemoved = false;
-    for (int i = 0; i < m_originalItems.size(); ++i)
-        m_idByText.insert(m_originalItems.at(i)->text(), i);
+    m_filterPrefix.clear();
+    m_idByText.clear();
 }
 
 bool GenericProposalModel::hasItemsToPropose(const QString &prefix, AssistReason reason) const
@@ -172,10 +178,10 @@ bool GenericProposalModel::isPerfectMatch(const QString &prefix) const
     if (prefix.isEmpty())
         return false;
 
+    const CaseSensitivity cs = TextEditorSettings::completionSettings().m_caseSensitivity;
     for (int i = 0; i < size(); ++i) {
         const QString &current = cleanText(text(i));
         if (!current.isEmpty()) {
-            CaseSensitivity cs = TextEditorSettings::completionSettings().m_caseSensitivity;
             if (cs == TextEditor::CaseSensitive) {
                 if (prefix == current)
                     return true;
@@ -205,6 +211,7 @@ void GenericProposalModel::setPrefilterPrefix(const QString &prefix)
 void GenericProposalModel::reset()
 {
     m_prefilterPrefix.clear();
+    m_filterPrefix.clear();
     m_currentItems = m_originalItems;
 }
 
@@ -259,9 +266,19 @@ void GenericProposalModel::filter(const QString &prefix)
         convertCaseSensitivity(TextEditorSettings::completionSettings().m_caseSensitivity);
     const QRegExp regExp = CamelHumpMatcher::createCamelHumpRegExp(prefix, caseSensitivity);
 
+    // While the user keeps typing, every new match was already a match of the
+    // shorter pattern, so the current items can be refiltered instead of
+    // running the regexp over the complete proposal again.
+    const QList<AssistProposalItemInterface *> source =
+            (!m_filterPrefix.isEmpty() && prefix.startsWith(m_filterPrefix)
+             && caseSensitivity == m_filterCaseSensitivity)
+            ? m_currentItems : m_originalItems;
+    m_filterPrefix = prefix;
+    m_filterCaseSensitivity = caseSensitivity;
+
     m_currentItems.clear();
     const QString lowerPrefix = prefix.toLower();
-    foreach (const auto &item, m_originalItems) {
+    foreach (const auto &item, source) {
         const QString &text = item->text();
         if (regExp.indexIn(text) == 0) {
             m_currentItems.append(item);
@@ -308,6 +325,13 @@ void GenericProposalModel::sort(const QString &prefix)
 
 int GenericProposalModel::persistentId(int index) const
 {
+    // Built on demand - the ids are only needed once the user explicitly
+    // selects an item, and filling the hash for a huge proposal would delay
+    // showing the popup.
+    if (m_idByText.isEmpty()) {
+        for (int i = 0; i < m_originalItems.size(); ++i)
+            m_idByText.insert(m_originalItems.at(i)->text(), i);
+    }
     return m_idByText.value(m_currentItems.at(index)->text());
 }
 
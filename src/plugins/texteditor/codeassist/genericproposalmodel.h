@@ -78,9 +78,12 @@ protected:
     QList<AssistProposalItemInterface *> m_currentItems;
 
 private:
-    QHash<QString, int> m_idByText;
+    mutable QHash<QString, int> m_idByText;
     QList<AssistProposalItemInterface *> m_originalItems;
     QString m_prefilterPrefix;
+    QString m_filterPrefix;
+    CamelHumpMatcher::CaseSensitivity m_filterCaseSensitivity
+        = CamelHumpMatcher::CaseSensitivity::CaseInsensitive;
     bool m_duplicatesRemoved = false;
 };
 } // TextEditor
@@ -402,8 +402,11 @@ bool GenericProposalWidget::updateAndCheck(const QString &prefix)
 
     // Filter, sort, etc.
     if (!d->m_model->isPrefiltered(prefix)) {
-        d->m_model->reset();
-        if (!prefix.isEmpty())
+        // filter() refines the current items when the prefix merely grew,
+        // so only fall back to the full list when there is no prefix at all.
+        if (prefix.isEmpty())
+            d->m_model->reset();
+        else
             d->m_model->filter(prefix);
     }
     if (!d->m_model->hasItemsToPropose(prefix, d->m_reason)) {
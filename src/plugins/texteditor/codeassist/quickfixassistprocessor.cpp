@@ -33,6 +33,11 @@
 // @TODO: Move...
 #include <texteditor/quickfix.h>
 
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+
+static Q_LOGGING_CATEGORY(log, "qtc.texteditor.quickfix")
+
 namespace TextEditor {
 
 QuickFixAssistProcessor::QuickFixAssistProcessor(const QuickFixAssistProvider *provider)
@@ -51,8 +56,17 @@ IAssistProposal *QuickFixAssistProcessor::perform(const AssistInterface *interfa
 
     QuickFixOperations quickFixes;
 
-    foreach (QuickFixFactory *factory, m_provider->quickFixFactories())
+    QElapsedTimer timer;
+    foreach (QuickFixFactory *factory, m_provider->quickFixFactories()) {
+        timer.restart();
         factory->matchingOperations(assistInterface, quickFixes);
+        // Factories that do not apply are expected to bail out quickly, so
+        // point out the ones that hold up the proposal.
+        if (timer.elapsed() > 10) {
+            qCDebug(log) << factory->metaObject()->className()
+                         << "took" << timer.elapsed() << "ms";
+        }
+    }
 
     if (!quickFixes.isEmpty()) {
         QList<AssistProposalItemInterface *> items;
@@ -70,7 +70,13 @@ void FontSettings::clear()
     m_fontZoom = 100;
     m_antialias = DEFAULT_ANTIALIAS;
     m_scheme.clear();
+    clearCaches();
+}
+
+void FontSettings::clearCaches()
+{
     m_formatCache.clear();
+    m_formatCacheValid.clear();
     m_textCharFormatCache.clear();
 }
 
@@ -138,19 +144,19 @@ bool FontSettings::equals(const FontSettings &f) const
             && m_scheme == f.m_scheme;
 }
 
-uint qHash(const TextStyle &textStyle)
-{
-    return ::qHash(quint8(textStyle));
-}
-
 /**
  * Returns the QTextCharFormat of the given format category.
  */
 QTextCharFormat FontSettings::toTextCharFormat(TextStyle category) const
 {
-    auto textCharFormatIterator = m_formatCache.find(category);
-    if (textCharFormatIterator != m_formatCache.end())
-        return *textCharFormatIterator;
+    // Highlighting loops query the formats constantly; indexing into a flat
+    // array keeps the lookup free of hashing.
+    if (m_formatCache.isEmpty()) {
+        m_formatCache.resize(C_LAST_STYLE_SENTINEL);
+        m_formatCacheValid.fill(false, C_LAST_STYLE_SENTINEL);
+    }
+    if (m_formatCacheValid.testBit(category))
+        return m_formatCache.at(category);
 
     const Format &f = m_scheme.formatFor(category);
     QTextCharFormat tf;
@@ -185,7 +191,8 @@ QTextCharFormat FontSettings::toTextCharFormat(TextStyle category) const
     tf.setUnderlineColor(f.underlineColor());
     tf.setUnderlineStyle(f.underlineStyle());
 
-    m_formatCache.insert(category, tf);
+    m_formatCache[category] = tf;
+    m_formatCacheValid.setBit(category);
     return tf;
 }
 
@@ -293,8 +300,7 @@ QString FontSettings::family() const
 void FontSettings::setFamily(const QString &family)
 {
     m_family = family;
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
 }
 
 /**
@@ -308,8 +314,7 @@ int FontSettings::fontSize() const
 void FontSettings::setFontSize(int size)
 {
     m_fontSize = size;
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
 }
 
 /**
@@ -323,8 +328,7 @@ int FontSettings::fontZoom() const
 void FontSettings::setFontZoom(int zoom)
 {
     m_fontZoom = zoom;
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
 }
 
 QFont FontSettings::font() const
@@ -345,8 +349,7 @@ bool FontSettings::antialias() const
 void FontSettings::setAntialias(bool antialias)
 {
     m_antialias = antialias;
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
 }
 
 /**
@@ -383,8 +386,7 @@ void FontSettings::setColorSchemeFileName(const QString &fileName)
 bool FontSettings::loadColorScheme(const QString &fileName,
                                    const FormatDescriptions &descriptions)
 {
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
     bool loaded = true;
     m_schemeFileName = fileName;
 
@@ -443,8 +445,7 @@ const ColorScheme &FontSettings::colorScheme() const
 void FontSettings::setColorScheme(const ColorScheme &scheme)
 {
     m_scheme = scheme;
-    m_formatCache.clear();
-    m_textCharFormatCache.clear();
+    clearCaches();
 }
 
 static QString defaultFontFamily()
@@ -30,6 +30,7 @@
 #include "colorscheme.h"
 #include "textstyles.h"
 
+#include <QBitArray>
 #include <QHash>
 #include <QList>
 #include <QString>
@@ -102,6 +103,7 @@ public:
 
 private:
     void addMixinStyle(QTextCharFormat &textCharFormat, const MixinTextStyles &mixinStyles) const;
+    void clearCaches();
 
 private:
     QString m_family;
@@ -110,7 +112,10 @@ private:
     int m_fontZoom;
     bool m_antialias;
     ColorScheme m_scheme;
-    mutable QHash<TextStyle, QTextCharFormat> m_formatCache;
+    // The text styles are a small dense enum, so the per-style formats are
+    // kept in a flat array indexed by the style.
+    mutable QVector<QTextCharFormat> m_formatCache;
+    mutable QBitArray m_formatCacheValid;
     mutable QHash<TextStyles, QTextCharFormat> m_textCharFormatCache;
 };
 
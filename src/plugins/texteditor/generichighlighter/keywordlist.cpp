@@ -34,6 +34,8 @@ void KeywordList::addKeyword(const QString &keyword)
         return;
 
     m_keywords.insert(keyword);
+    if (!m_lowerKeywords.isEmpty())
+        m_lowerKeywords.insert(keyword.toLower());
 }
 
 bool KeywordList::isKeyword(const QString &keyword, Qt::CaseSensitivity sensitivity) const
@@ -41,17 +43,18 @@ bool KeywordList::isKeyword(const QString &keyword, Qt::CaseSensitivity sensitiv
     if (keyword.isEmpty())
         return false;
 
-    // Case sensitivity could be implemented, for example, by converting all keywords to lower
-    // if the global sensitivity attribute is insensitive, then always checking for containment
-    // (with a conversion to lower in the necessary cases). But the code below is one alternative
-    // to support the existence of local sensitivity attributes (which override the global one -
-    // currently not documented).
-    if (sensitivity == Qt::CaseSensitive) {
+    // Local sensitivity attributes can override the global one (currently not
+    // documented), so both kinds of lookup must stay available on the same
+    // list. The lowercased set is only built once a case-insensitive lookup
+    // actually happens; a linear scan over the keywords per candidate word
+    // made case-insensitive definitions crawl on long files.
+    if (sensitivity == Qt::CaseSensitive)
         return m_keywords.contains(keyword);
-    } else {
+
+    if (m_lowerKeywords.isEmpty() && !m_keywords.isEmpty()) {
+        m_lowerKeywords.reserve(m_keywords.size());
         foreach (const QString &s, m_keywords)
-            if (keyword.compare(s, Qt::CaseInsensitive) == 0)
-                return true;
-        return false;
+            m_lowerKeywords.insert(s.toLower());
     }
+    return m_lowerKeywords.contains(keyword.toLower());
 }
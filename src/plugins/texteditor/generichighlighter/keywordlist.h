@@ -40,6 +40,7 @@ public:
 
 private:
     QSet<QString> m_keywords;
+    mutable QSet<QString> m_lowerKeywords; // built on first case-insensitive lookup
 };
 
 } // namespace Internal
@@ -160,7 +160,15 @@ bool StringDetectRule::doMatchSucceed(const QString &text,
                                       const int length,
                                       ProgressData *progress)
 {
-    if (length - progress->offset() >= m_length) {
+    if (length - progress->offset() >= m_length && m_length > 0) {
+        // Cheap first-character test before comparing the whole string; this
+        // rule is attempted at every offset of the line.
+        const QChar first = text.at(progress->offset());
+        if (m_caseSensitivity == Qt::CaseSensitive
+                ? first != m_string.at(0)
+                : first.toLower() != m_string.at(0).toLower()) {
+            return false;
+        }
         QString candidate = text.fromRawData(text.unicode() + progress->offset(), m_length);
         if (candidate.compare(m_string, m_caseSensitivity) == 0) {
             progress->incrementOffset(m_length);
@@ -28,8 +28,23 @@
 #include <coreplugin/helpmanager.h>
 #include <utils/htmldocextractor.h>
 
+#include <QCache>
+
 using namespace TextEditor;
 
+namespace {
+
+// Extracting the contents reads the documentation HTML from the help engine
+// and parses it, which is too slow to redo on every hover over the same
+// symbol, so the extracted fragments are kept in a small LRU cache.
+QCache<QString, QString> &extractedContentCache()
+{
+    static QCache<QString, QString> cache(100);
+    return cache;
+}
+
+} // Anonymous
+
 HelpItem::HelpItem()
 {}
 
@@ -80,6 +95,12 @@ bool HelpItem::isValid() const
 
 QString HelpItem::extractContent(bool extended) const
 {
+    const QString cacheKey = m_helpId + QLatin1Char('\n') + m_docMark + QLatin1Char('\n')
+            + QString::number(m_category) + QLatin1Char('\n')
+            + (extended ? QLatin1Char('x') : QLatin1Char('f'));
+    if (const QString *cached = extractedContentCache().object(cacheKey))
+        return *cached;
+
     Utils::HtmlDocExtractor htmlExtractor;
     if (extended)
         htmlExtractor.setMode(Utils::HtmlDocExtractor::Extended);
@@ -132,6 +153,7 @@ QString HelpItem::extractContent(bool extended) const
         if (!contents.isEmpty())
             break;
     }
+    extractedContentCache().insert(cacheKey, new QString(contents));
     return contents;
 }
 
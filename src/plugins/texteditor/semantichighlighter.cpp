@@ -80,6 +80,7 @@ void SemanticHighlighter::incrementalApplyExtraAdditionalFormats(
     QTextBlock b = doc->findBlockByNumber(currentBlockNumber);
 
     HighlightingResult result = future.resultAt(from);
+    QVector<QTextLayout::FormatRange> formats; // reused for each line to keep its allocation
     for (int i = from; i < to && b.isValid(); ) {
         const int blockNumber = result.line - 1;
         QTC_ASSERT(blockNumber < doc->blockCount(), return);
@@ -93,8 +94,7 @@ void SemanticHighlighter::incrementalApplyExtraAdditionalFormats(
         }
 
         // collect all the formats for the current line
-        QVector<QTextLayout::FormatRange> formats;
-        formats.reserve(to - from);
+        formats.resize(0);
         forever {
             QTextLayout::FormatRange formatRange;
 
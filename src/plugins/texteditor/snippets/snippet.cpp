@@ -113,6 +113,7 @@ const QString &Snippet::trigger() const
 void Snippet::setContent(const QString &content)
 {
     m_content = content;
+    m_cachedTip.clear();
 }
 
 const QString &Snippet::content() const
@@ -152,6 +153,12 @@ bool Snippet::isModified() const
 
 QString Snippet::generateTip() const
 {
+    // The tip is requested for every snippet on each completion request,
+    // and deriving it walks the whole content. Cache it per content; the
+    // result always starts with "<nobr>", so an empty string means "dirty".
+    if (!m_cachedTip.isEmpty())
+        return m_cachedTip;
+
     static const QLatin1Char kNewLine('\n');
     static const QLatin1Char kSpace(' ');
     static const QLatin1String kBr("<br>");
@@ -181,7 +188,8 @@ QString Snippet::generateTip() const
         }
     }
 
-    return tip;
+    m_cachedTip = tip;
+    return m_cachedTip;
 }
 
 Snippet::ParsedSnippet Snippet::parse(const QString &snippet)
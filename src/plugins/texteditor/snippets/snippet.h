@@ -99,6 +99,7 @@ private:
     QString m_trigger;
     QString m_content;
     QString m_complement;
+    mutable QString m_cachedTip; // Lazily derived from the content.
 };
 
 } // TextEditor
@@ -98,6 +98,11 @@ SnippetsCollection::SnippetsCollection() :
 
     connect(Core::ICore::instance(), &Core::ICore::coreOpened,
             this, &SnippetsCollection::identifyGroups);
+
+    // Pick up edits of the user snippets file made outside the options
+    // dialog without requiring a restart.
+    connect(&m_userSnippetsFileWatcher, &Utils::FileSystemWatcher::fileChanged,
+            this, &SnippetsCollection::reload);
 }
 
 SnippetsCollection::~SnippetsCollection()
@@ -291,6 +296,15 @@ void SnippetsCollection::reload()
 
     foreach (const Snippet &snippet, activeBuiltInSnippets)
         insertSnippet(snippet);
+
+    updateUserSnippetsFileWatch();
+}
+
+void SnippetsCollection::updateUserSnippetsFileWatch()
+{
+    const QString fileName = m_userSnippetsPath + m_userSnippetsFile;
+    if (QFile::exists(fileName) && !m_userSnippetsFileWatcher.watchesFile(fileName))
+        m_userSnippetsFileWatcher.addFile(fileName, Utils::FileSystemWatcher::WatchAllChanges);
 }
 
 bool SnippetsCollection::synchronize(QString *errorString)
@@ -300,6 +314,13 @@ bool SnippetsCollection::synchronize(QString *errorString)
                 QDir::toNativeSeparators(m_userSnippetsPath));
         return false;
     }
+
+    // Suspend the watch while writing the file ourselves; reload() below
+    // restores it. Otherwise our own save would trigger a second reload.
+    const QString userSnippetsFileName = m_userSnippetsPath + m_userSnippetsFile;
+    if (m_userSnippetsFileWatcher.watchesFile(userSnippetsFileName))
+        m_userSnippetsFileWatcher.removeFile(userSnippetsFileName);
+
     Utils::FileSaver saver(m_userSnippetsPath + m_userSnippetsFile);
     if (!saver.hasError()) {
         typedef QHash<QString, int>::ConstIterator GroupIndexByIdConstIt;
@@ -323,8 +344,10 @@ bool SnippetsCollection::synchronize(QString *errorString)
 
         saver.setResult(&writer);
     }
-    if (!saver.finalize(errorString))
+    if (!saver.finalize(errorString)) {
+        updateUserSnippetsFileWatch();
         return false;
+    }
 
     reload();
     return true;
@@ -27,6 +27,8 @@
 
 #include "snippet.h"
 
+#include <utils/filesystemwatcher.h>
+
 #include <QVector>
 #include <QStringList>
 #include <QHash>
@@ -93,6 +95,7 @@ public:
 
 private:
     void identifyGroups();
+    void updateUserSnippetsFileWatch();
 
     SnippetsCollection();
 
@@ -125,6 +128,9 @@ private:
     QString m_userSnippetsFile;
     QStringList m_builtInSnippetsFiles;
 
+    // Picks up external modifications of the user snippets file.
+    Utils::FileSystemWatcher m_userSnippetsFileWatcher;
+
     // Snippets for each group are kept in a list. However, not all of them are necessarily
     // active. Specifically, removed built-in snippets are kept as the last ones (for each
     // group there is a iterator that marks the logical end).
@@ -33,6 +33,7 @@
 #include <utils/asconst.h>
 #include <utils/qtcassert.h>
 
+#include <QElapsedTimer>
 #include <QTextDocument>
 #include <QPointer>
 #include <qtimer.h>
@@ -71,6 +72,8 @@ public:
     QTextBlock currentBlock;
     bool rehighlightPending = false;
     bool inReformatBlocks = false;
+    int continueFrom = -1; // position where an interrupted long rehighlight resumes
+    int continueEnd = -1;
     TextDocumentLayout::FoldValidator foldValidator;
     QVector<QTextCharFormat> formats;
     QVector<std::pair<int,TextStyle>> formatCategories;
@@ -99,6 +102,20 @@ void SyntaxHighlighter::delayedRehighlight()
     rehighlight();
 }
 
+void SyntaxHighlighter::continueRehighlight()
+{
+    Q_D(SyntaxHighlighter);
+    if (d->continueFrom < 0 || !d->doc)
+        return;
+    const int from = d->continueFrom;
+    const int length = qMax(d->continueEnd - from, 1);
+    d->continueFrom = -1;
+    d->continueEnd = -1;
+    d->inReformatBlocks = true;
+    d->reformatBlocks(from, 0, length);
+    d->inReformatBlocks = false;
+}
+
 void SyntaxHighlighterPrivate::applyFormatChanges(int from, int charsRemoved, int charsAdded)
 {
     bool formatsChanged = false;
@@ -173,8 +190,19 @@ void SyntaxHighlighter::reformatBlocks(int from, int charsRemoved, int charsAdde
         d->reformatBlocks(from, charsRemoved, charsAdded);
 }
 
+// Highlighting a single long stretch (e.g. the initial pass over a large
+// document) must not block the GUI thread, so reformatBlocks() gives up after
+// this many milliseconds and finishes in later event loop iterations.
+enum { MaxHighlightingSliceMsecs = 20 };
+
 void SyntaxHighlighterPrivate::reformatBlocks(int from, int charsRemoved, int charsAdded)
 {
+    // Keep the resume point of a pending continuation valid across edits.
+    if (continueFrom >= from)
+        continueFrom = qMax(from, continueFrom + charsAdded - charsRemoved);
+    if (continueEnd >= from)
+        continueEnd = qMax(from, continueEnd + charsAdded - charsRemoved);
+
     foldValidator.reset();
 
     rehighlightPending = false;
@@ -191,6 +219,8 @@ void SyntaxHighlighterPrivate::reformatBlocks(int from, int charsRemoved, int ch
         endPosition =  doc->lastBlock().position() + doc->lastBlock().length(); //doc->docHandle()->length();
 
     bool forceHighlightOfNextBlock = false;
+    QElapsedTimer sliceTimer;
+    sliceTimer.start();
 
     while (block.isValid() && (block.position() < endPosition || forceHighlightOfNextBlock)) {
         const int stateBeforeHighlight = block.userState();
@@ -200,6 +230,17 @@ void SyntaxHighlighterPrivate::reformatBlocks(int from, int charsRemoved, int ch
         forceHighlightOfNextBlock = (block.userState() != stateBeforeHighlight);
 
         block = block.next();
+
+        if (block.isValid() && (block.position() < endPosition || forceHighlightOfNextBlock)
+                && sliceTimer.elapsed() > MaxHighlightingSliceMsecs) {
+            // Block states propagate from the resume point, so continuing
+            // later yields the same result as one synchronous pass.
+            continueFrom = block.position();
+            continueEnd = forceHighlightOfNextBlock ? qMax(endPosition, block.position() + 1)
+                                                    : endPosition;
+            QTimer::singleShot(0, q_func(), &SyntaxHighlighter::continueRehighlight);
+            break;
+        }
     }
 
     formatChanges.clear();
@@ -306,6 +347,8 @@ void SyntaxHighlighter::setDocument(QTextDocument *doc)
     Q_D(SyntaxHighlighter);
     if (d->doc) {
         disconnect(d->doc, &QTextDocument::contentsChange, this, &SyntaxHighlighter::reformatBlocks);
+        d->continueFrom = -1;
+        d->continueEnd = -1;
 
         QTextCursor cursor(d->doc);
         cursor.beginEditBlock();
@@ -682,9 +725,24 @@ void SyntaxHighlighter::setExtraFormats(const QTextBlock &block,
     if (block.layout() == 0 || blockLength == 0)
         return;
 
+    const QVector<QTextLayout::FormatRange> all = block.layout()->formats();
+
+    if (formats.isEmpty()) {
+        // Common when clearing: most blocks never had semantic formats, so
+        // don't build the (allocating) partition below just to find that out.
+        bool hadSemanticFormats = false;
+        foreach (const QTextLayout::FormatRange &r, all) {
+            if (r.format.hasProperty(QTextFormat::UserProperty)) {
+                hadSemanticFormats = true;
+                break;
+            }
+        }
+        if (!hadSemanticFormats)
+            return;
+    }
+
     Utils::sort(formats, byStartOfRange);
 
-    const QVector<QTextLayout::FormatRange> all = block.layout()->formats();
     QVector<QTextLayout::FormatRange> previousSemanticFormats;
     QVector<QTextLayout::FormatRange> formatsToApply;
     previousSemanticFormats.reserve(all.size());
@@ -107,6 +107,7 @@ private:
     void setTextFormatCategories(const QVector<std::pair<int, TextStyle>> &categories);
     void reformatBlocks(int from, int charsRemoved, int charsAdded);
     void delayedRehighlight();
+    void continueRehighlight();
 
     QScopedPointer<SyntaxHighlighterPrivate> d_ptr;
 };
@@ -386,6 +386,7 @@ TextDocumentLayout::TextDocumentLayout(QTextDocument *doc)
     : QPlainTextDocumentLayout(doc),
       lastSaveRevision(0),
       hasMarks(false),
+      foldedBlocks(0),
       maxMarkWidthFactor(1.0),
       m_requiredWidth(0)
 {}
@@ -522,10 +523,16 @@ bool TextDocumentLayout::isFolded(const QTextBlock &block)
 
 void TextDocumentLayout::setFolded(const QTextBlock &block, bool folded)
 {
+    if (folded == isFolded(block))
+        return;
     if (folded)
         userData(block)->setFolded(true);
     else if (TextBlockUserData *userData = testUserData(block))
         userData->setFolded(false);
+    else
+        return;
+    if (auto layout = qobject_cast<TextDocumentLayout *>(block.document()->documentLayout()))
+        layout->foldedBlocks += folded ? 1 : -1;
 }
 
 void TextDocumentLayout::requestExtraAreaUpdate()
@@ -605,12 +612,16 @@ void TextDocumentLayout::documentReloaded(TextMarks marks, TextDocument *baseTex
     requestUpdate();
 }
 
-void TextDocumentLayout::updateMarksLineNumber()
+void TextDocumentLayout::updateMarksLineNumber(const QTextBlock &fromBlock)
 {
     // Note: the breakpointmanger deletes breakpoint marks and readds them
     // if it doesn't agree with our updating
-    QTextBlock block = document()->begin();
-    int blockNumber = 0;
+    if (!hasMarks)
+        return;
+    // Blocks before the edited one keep their line numbers, so only the rest
+    // of the document needs to be walked.
+    QTextBlock block = fromBlock;
+    int blockNumber = block.blockNumber();
     while (block.isValid()) {
         if (const TextBlockUserData *userData = testUserData(block))
             foreach (TextMark *mrk, userData->marks())
@@ -654,12 +665,13 @@ void TextDocumentLayout::FoldValidator::process(QTextBlock block)
         return;
 
     const bool preIsFolded = isFolded(previous);
-    const bool preCanFold = canFold(previous);
     const bool isVisible = block.isVisible();
 
-    if (preIsFolded && !preCanFold)
+    // canFold() needs the folding indents of two blocks, so only evaluate it
+    // on the rare paths that actually change the folded state.
+    if (preIsFolded && !canFold(previous))
         setFolded(previous, false);
-    else if (!preIsFolded && preCanFold && previous.isVisible() && !isVisible)
+    else if (!preIsFolded && previous.isVisible() && !isVisible && canFold(previous))
         setFolded(previous, true);
 
     if (isFolded(previous) && !m_insideFold)
@@ -204,6 +204,10 @@ public:
 
     int lastSaveRevision;
     bool hasMarks;
+    // Number of folded blocks. May overcount when folded blocks are removed
+    // by edits; only the == 0 case may be relied upon, to skip scanning the
+    // whole document when nothing is folded.
+    int foldedBlocks;
     double maxMarkWidthFactor;
 
     int m_requiredWidth;
@@ -214,7 +218,7 @@ public:
 
     TextMarks documentClosing();
     void documentReloaded(TextMarks marks, TextDocument *baseextDocument);
-    void updateMarksLineNumber();
+    void updateMarksLineNumber(const QTextBlock &fromBlock);
     void updateMarksBlock(const QTextBlock &block);
 
 signals:
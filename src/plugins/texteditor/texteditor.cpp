@@ -1226,12 +1226,12 @@ void TextEditorWidgetPrivate::editorContentsChange(int position, int charsRemove
 
     // Keep the line numbers and the block information for the text marks updated
     if (charsRemoved != 0) {
-        documentLayout->updateMarksLineNumber();
+        documentLayout->updateMarksLineNumber(posBlock);
         documentLayout->updateMarksBlock(posBlock);
     } else {
         const QTextBlock nextBlock = doc->findBlock(position + charsAdded);
         if (posBlock != nextBlock) {
-            documentLayout->updateMarksLineNumber();
+            documentLayout->updateMarksLineNumber(posBlock);
             documentLayout->updateMarksBlock(posBlock);
             documentLayout->updateMarksBlock(nextBlock);
         } else {
@@ -2865,13 +2865,18 @@ QByteArray TextEditorWidget::saveState() const
 
     // store code folding state
     QList<int> foldedBlocks;
-    QTextBlock block = document()->firstBlock();
-    while (block.isValid()) {
-        if (block.userData() && static_cast<TextBlockUserData*>(block.userData())->folded()) {
-            int number = block.blockNumber();
-            foldedBlocks += number;
+    // saveState() runs on every switch away from an editor for the navigation
+    // history; only walk the blocks when something is folded at all.
+    auto documentLayout = qobject_cast<TextDocumentLayout*>(document()->documentLayout());
+    if (!documentLayout || documentLayout->foldedBlocks > 0) {
+        QTextBlock block = document()->firstBlock();
+        while (block.isValid()) {
+            if (block.userData() && static_cast<TextBlockUserData*>(block.userData())->folded()) {
+                int number = block.blockNumber();
+                foldedBlocks += number;
+            }
+            block = block.next();
         }
-        block = block.next();
     }
     stream << foldedBlocks;
 
@@ -3013,7 +3018,13 @@ void TextEditorWidgetPrivate::updateCodeFoldingVisible()
 
 void TextEditorWidgetPrivate::reconfigure()
 {
-    m_document->setMimeType(Utils::mimeTypeForFile(m_document->filePath().toString()).name());
+    const QString mimeType = Utils::mimeTypeForFile(m_document->filePath().toString()).name();
+    // Every widget showing the document listens to filePathChanged, but the
+    // highlighter lives on the shared document. Don't replace it - and
+    // rehighlight everything - once per split when the mime type is unchanged.
+    if (mimeType == m_document->mimeType() && m_document->syntaxHighlighter())
+        return;
+    m_document->setMimeType(mimeType);
     q->configureGenericHighlighter();
 }
 
@@ -6662,6 +6673,10 @@ void TextEditorWidgetPrivate::setExtraSelections(Id kind, const QList<QTextEdit:
         m_snippetOverlay->setVisible(!m_snippetOverlay->isEmpty());
     } else {
         QList<QTextEdit::ExtraSelection> all;
+        int count = 0;
+        for (auto i = m_extraSelections.constBegin(); i != m_extraSelections.constEnd(); ++i)
+            count += i.value().size();
+        all.reserve(count);
         for (auto i = m_extraSelections.constBegin(); i != m_extraSelections.constEnd(); ++i) {
             if (i.key() == TextEditorWidget::CodeSemanticsSelection
                 || i.key() == TextEditorWidget::SnippetPlaceholderSelection)
@@ -7993,6 +8008,11 @@ QString TextEditorWidget::textAt(int from, int to) const
     return textDocument()->textAt(from, to);
 }
 
+// Documents larger than this stay plain: interpreting a Kate definition over
+// every block plus the per-block folding data takes seconds on open for big
+// generated or log files, and costs again on every change near the end.
+enum { MaxGenericHighlightingDocumentSize = 16 * 1024 * 1024 };
+
 void TextEditorWidget::configureGenericHighlighter()
 {
     Highlighter *highlighter = new Highlighter();
@@ -8003,7 +8023,8 @@ void TextEditorWidget::configureGenericHighlighter()
 
     const QString type = textDocument()->mimeType();
     const MimeType mimeType = Utils::mimeTypeForName(type);
-    if (mimeType.isValid()) {
+    if (mimeType.isValid()
+            && textDocument()->document()->characterCount() <= MaxGenericHighlightingDocumentSize) {
         d->m_isMissingSyntaxDefinition = true;
 
         QString definitionId;
@@ -8075,8 +8096,10 @@ void TextEditorWidget::setupGenericHighlighter()
     connect(textDocument(), &IDocument::filePathChanged,
             d, &TextEditorWidgetPrivate::reconfigure);
 
+    // Newly registered definitions must be applied even though the mime type
+    // did not change, so bypass the reconfigure() guard.
     connect(Manager::instance(), &Manager::highlightingFilesRegistered,
-            d, &TextEditorWidgetPrivate::reconfigure);
+            this, &TextEditorWidget::configureGenericHighlighter);
 
     updateEditorInfoBar(this);
 }
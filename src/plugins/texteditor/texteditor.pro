@@ -80,6 +80,7 @@ SOURCES += texteditorplugin.cpp \
     convenience.cpp \
     codeassist/runner.cpp \
     codeassist/completionassistprovider.cpp \
+    codeassist/completionusage.cpp \
     codeassist/genericproposalmodel.cpp \
     codeassist/quickfixassistprovider.cpp \
     codeassist/quickfixassistprocessor.cpp \
@@ -192,6 +193,7 @@ HEADERS += texteditorplugin.h \
     codeassist/runner.h \
     codeassist/assistproposaliteminterface.h \
     codeassist/completionassistprovider.h \
+    codeassist/completionusage.h \
     codeassist/genericproposalmodel.h \
     codeassist/quickfixassistprovider.h \
     codeassist/quickfixassistprocessor.h \
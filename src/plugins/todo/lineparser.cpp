@@ -61,18 +61,18 @@ LineParser::KeywordEntryCandidates LineParser::findKeywordEntryCandidates(const
 {
     KeywordEntryCandidates entryCandidates;
 
-    for (int i = 0; i < m_keywords.count(); ++i) {
-        int searchFrom = -1;
-        forever {
-            const int index = line.lastIndexOf(m_keywords.at(i).name, searchFrom);
-
-            if (index == -1)
-                break; // 'forever' loop exit condition
-
-            searchFrom = index - line.length() - 1;
-
-            if (isKeywordAt(index, line, m_keywords.at(i).name))
+    // check all keywords in a single pass over the line, only at positions
+    // where a word starts, instead of searching the whole line once per keyword
+    for (int index = 0; index < line.length(); ++index) {
+        if (!isFirstCharOfTheWord(index, line))
+            continue;
+
+        for (int i = 0; i < m_keywords.count(); ++i) {
+            const QString &keyword = m_keywords.at(i).name;
+            if (line.midRef(index, keyword.length()) == keyword
+                    && isLastCharOfTheWord(index + keyword.length() - 1, line)) {
                 entryCandidates.insert(index, i);
+            }
         }
     }
 
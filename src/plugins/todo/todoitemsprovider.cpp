@@ -124,13 +124,17 @@ void TodoItemsProvider::setItemsListWithinStartupProject()
 
     QVariantMap settings = m_startupProject->namedSettings(QLatin1String(Constants::SETTINGS_NAME_KEY)).toMap();
 
+    // compile the exclude patterns once instead of for every file
+    QList<QRegExp> excludes;
+    for (const QVariant &pattern : settings[QLatin1String(Constants::EXCLUDES_LIST_KEY)].toList())
+        excludes << QRegExp(pattern.toString());
+
     while (it.hasNext()) {
         it.next();
         QString fileName = it.key();
         if (fileNames.contains(fileName)) {
             bool skip = false;
-            for (const QVariant &pattern : settings[QLatin1String(Constants::EXCLUDES_LIST_KEY)].toList()) {
-                QRegExp re(pattern.toString());
+            for (QRegExp &re : excludes) {
                 if (re.indexIn(fileName) != -1) {
                     skip = true;
                     break;
@@ -52,6 +52,7 @@ QVector<const Function *> CycleDetection::run(const QVector<const Function *> &i
         node->function = function;
         node->dfs = -1;
         node->lowlink = -1;
+        node->onStack = false;
         m_nodes.insert(function, node);
     }
     foreach (Node *node, m_nodes) {
@@ -70,6 +71,7 @@ void CycleDetection::tarjan(Node *node)
 
     m_depth++;
     m_stack.push(node);
+    node->onStack = true;
 
     foreach (const FunctionCall *call, node->function->outgoingCalls())
         tarjanForChildNode(node, m_nodes.value(call->callee()));
@@ -79,6 +81,7 @@ void CycleDetection::tarjan(Node *node)
         Node *n;
         do {
             n = m_stack.pop();
+            n->onStack = false;
             functions << n->function;
         } while (n != node);
 
@@ -106,7 +109,7 @@ void CycleDetection::tarjanForChildNode(Node *node, Node *childNode)
         tarjan(childNode);
         if (childNode->lowlink < node->lowlink)
             node->lowlink = childNode->lowlink;
-    } else if (childNode->dfs < node->lowlink && m_stack.contains(childNode)) {
+    } else if (childNode->dfs < node->lowlink && childNode->onStack) {
         node->lowlink = childNode->dfs;
     }
 }
@@ -57,6 +57,7 @@ private:
         int dfs;
         int lowlink;
         const Function *function;
+        bool onStack;
     };
 
     void tarjan(Node *node);
@@ -65,10 +65,12 @@ void Function::Private::accumulateCost(QVector<quint64> &base, const QVector<qui
     if (base.isEmpty()) {
         base = add;
     } else {
-        ///TODO: see whether .data() is noticably faster (less detaching)
-        int i = 0;
-        foreach (quint64 cost, add)
-            base[i++] += cost;
+        // runs once per cost line in the parsed file, so detach only once
+        // instead of on every operator[]
+        quint64 *baseData = base.data();
+        const quint64 *addData = add.constData();
+        for (int i = 0, c = add.size(); i < c; ++i)
+            baseData[i] += addData[i];
     }
 }
 
@@ -273,8 +275,9 @@ QVector<const CostItem *> Function::costItems() const
 
 void Function::addCostItem(const CostItem *item)
 {
-    QTC_ASSERT(!d->m_costItems.contains(item), return);
-
+    // the parser hands in a freshly allocated item for every cost line; don't
+    // scan all previous items for duplicates here, that makes loading large
+    // callgrind files quadratic in the number of cost lines per function
     d->m_costItems.append(item);
 
     // accumulate costs
@@ -45,16 +45,20 @@ namespace XmlProtocol {
 class ErrorItem : public Utils::TreeItem
 {
 public:
-    ErrorItem(const ErrorListModel *model, const Error &error);
+    ErrorItem(ErrorListModel *model, const Error &error);
+    ~ErrorItem() override;
 
     const ErrorListModel *modelPrivate() const { return m_model; }
     Error error() const { return m_error; }
 
+    void addOccurrence() { ++m_occurrences; update(); }
+
 private:
     QVariant data(int column, int role) const override;
 
-    const ErrorListModel * const m_model;
+    ErrorListModel * const m_model;
     const Error m_error;
+    quint64 m_occurrences = 1;
 };
 
 class StackItem : public Utils::TreeItem
@@ -90,6 +94,14 @@ ErrorListModel::ErrorListModel(QObject *parent)
     setHeader(QStringList() << tr("Issue") << tr("Location"));
 }
 
+ErrorListModel::~ErrorListModel()
+{
+    // The items unregister from m_errorIndex when they are destroyed; take
+    // them down while that member is still alive instead of leaving it to
+    // the base class destructor, which runs after our members are gone.
+    Utils::TreeModel<>::clear();
+}
+
 Frame ErrorListModel::findRelevantFrame(const Error &error) const
 {
     if (m_relevantFrameFinder)
@@ -139,9 +151,32 @@ QString ErrorListModel::errorLocation(const Error &error) const
             arg(makeFrameName(findRelevantFrame(error), true));
 }
 
+static uint stackSignature(const Error &error)
+{
+    uint signature = qHash(error.kind());
+    foreach (const Stack &stack, error.stacks()) {
+        foreach (const Frame &frame, stack.frames())
+            signature = (signature << 1) ^ qHash(frame.instructionPointer());
+    }
+    return signature;
+}
+
 void ErrorListModel::addError(const Error &error)
 {
-    rootItem()->appendChild(new ErrorItem(this, error));
+    // Long running processes can report the same error again and again.
+    // Appending one item per repetition would make both the model and the view
+    // unusable, so count repetitions on the item with the same stacks instead.
+    const uint signature = stackSignature(error);
+    foreach (ErrorItem *item, m_errorIndex.value(signature)) {
+        if (item->error().kind() == error.kind() && item->error().stacks() == error.stacks()) {
+            item->addOccurrence();
+            return;
+        }
+    }
+
+    ErrorItem * const item = new ErrorItem(this, error);
+    m_errorIndex[signature].append(item);
+    rootItem()->appendChild(item);
 }
 
 ErrorListModel::RelevantFrameFinder ErrorListModel::relevantFrameFinder() const
@@ -155,7 +190,7 @@ void ErrorListModel::setRelevantFrameFinder(const RelevantFrameFinder &relevantF
 }
 
 
-ErrorItem::ErrorItem(const ErrorListModel *model, const Error &error)
+ErrorItem::ErrorItem(ErrorListModel *model, const Error &error)
     : m_model(model), m_error(error)
 {
     QTC_ASSERT(!m_error.stacks().isEmpty(), return);
@@ -173,6 +208,17 @@ ErrorItem::ErrorItem(const ErrorListModel *model, const Error &error)
     }
 }
 
+ErrorItem::~ErrorItem()
+{
+    // Items can be deleted through the base TreeModel API, not only via
+    // ErrorListModel; unregister here so no dangling pointer survives
+    // whatever removed the item.
+    QVector<ErrorItem *> &bucket = m_model->m_errorIndex[stackSignature(m_error)];
+    bucket.removeOne(this);
+    if (bucket.isEmpty())
+        m_model->m_errorIndex.remove(stackSignature(m_error));
+}
+
 static QVariant location(const Frame &frame, int role)
 {
     switch (role) {
@@ -216,15 +262,21 @@ QVariant ErrorItem::data(int column, int role) const
     }
     case ErrorListModel::ErrorRole:
         return QVariant::fromValue<Error>(m_error);
-    case Qt::DisplayRole:
+    case Qt::DisplayRole: {
+        QString display;
         // If and only if there is exactly one frame, we have omitted creating a child item for it
         // (see the constructor) and display the function name in the error item instead.
         if (m_error.stacks().count() != 1 || m_error.stacks().first().frames().count() != 1
                 || m_error.stacks().first().frames().first().functionName().isEmpty()) {
-            return m_error.what();
+            display = m_error.what();
+        } else {
+            display = ErrorListModel::tr("%1 in function %2")
+                    .arg(m_error.what(), m_error.stacks().first().frames().first().functionName());
         }
-        return ErrorListModel::tr("%1 in function %2")
-                .arg(m_error.what(), m_error.stacks().first().frames().first().functionName());
+        if (m_occurrences > 1)
+            display = ErrorListModel::tr("%1 (repeated %2 times)").arg(display).arg(m_occurrences);
+        return display;
+    }
     case Qt::ToolTipRole:
         return toolTipForFrame(m_model->findRelevantFrame(m_error));
     default:
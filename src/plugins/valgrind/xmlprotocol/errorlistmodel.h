@@ -29,12 +29,15 @@
 #include <debugger/analyzer/detailederrorview.h>
 #include <utils/treemodel.h>
 
+#include <QHash>
+
 #include <functional>
 
 namespace Valgrind {
 namespace XmlProtocol {
 
 class Error;
+class ErrorItem;
 class Frame;
 
 class ErrorListModel : public Utils::TreeModel<>
@@ -47,6 +50,7 @@ public:
     };
 
     explicit ErrorListModel(QObject *parent = 0);
+    ~ErrorListModel() override;
 
     typedef std::function<Frame(const Error &)> RelevantFrameFinder;
     RelevantFrameFinder relevantFrameFinder() const;
@@ -62,6 +66,10 @@ private:
     QString errorLocation(const Error &error) const;
 
     RelevantFrameFinder m_relevantFrameFinder;
+
+    // errors by stack signature, so that repetitions of the same error can be
+    // counted instead of adding ever more identical items
+    QHash<uint, QVector<ErrorItem *> > m_errorIndex;
 };
 
 } // namespace XmlProtocol
@@ -387,11 +387,26 @@ void WelcomeMode::addPage(IWelcomePage *page)
 
     m_sideBar->m_pluginButtons->insertWidget(idx, pageButton);
 
-    QWidget *stackPage = page->createWidget();
+    // Creating a page's widget builds its whole content, e.g. the grid of
+    // examples, which is wasted effort for pages the user never opens. Only
+    // insert a placeholder here and fill it when the page is shown first.
+    auto stackPage = new QWidget;
     stackPage->setAutoFillBackground(true);
     m_pageStack->insertWidget(idx, stackPage);
 
-    auto onClicked = [this, page, pageId, stackPage] {
+    auto ensurePageWidget = [page, stackPage] {
+        if (stackPage->layout())
+            return;
+        auto layout = new QVBoxLayout(stackPage);
+        layout->setMargin(0);
+        layout->setSpacing(0);
+        QWidget *pageWidget = page->createWidget();
+        pageWidget->setAutoFillBackground(true);
+        layout->addWidget(pageWidget);
+    };
+
+    auto onClicked = [this, pageId, stackPage, ensurePageWidget] {
+        ensurePageWidget();
         m_activePage = pageId;
         m_pageStack->setCurrentWidget(stackPage);
         for (WelcomePageButton *pageButton : m_pageButtons)
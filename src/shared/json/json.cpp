@@ -4547,31 +4547,24 @@ bool Parser::parseString()
 {
     const char *inStart = json;
 
-    // First try quick pass without escapes.
-    if (true) {
-        while (1) {
-            if (json >= end) {
-                ++json;
-                lastError = JsonParseError::UnterminatedString;
-                return false;
-            }
-
-            const char c = *json;
-            if (c == '"') {
-                // write string length and padding.
-                const int len = static_cast<int>(json - inStart);
-                const int pos = reserveSpace(4 + alignedSize(len));
-                toInternal(data + pos, inStart, len);
-                END;
-
-                ++json;
-                return true;
-            }
+    // First try quick pass without escapes. memchr is typically vectorized
+    // by the C library, which pays off on the long string values found in
+    // metadata files.
+    const char *quote = static_cast<const char *>(memchr(json, '"', end - json));
+    if (!quote) {
+        json = end + 1;
+        lastError = JsonParseError::UnterminatedString;
+        return false;
+    }
+    if (!memchr(json, '\\', quote - json)) {
+        // write string length and padding.
+        const int len = static_cast<int>(quote - inStart);
+        const int pos = reserveSpace(4 + alignedSize(len));
+        toInternal(data + pos, inStart, len);
+        END;
 
-            if (c == '\\')
-                break;
-            ++json;
-        }
+        json = quote + 1;
+        return true;
     }
 
     // Try again with escapes.
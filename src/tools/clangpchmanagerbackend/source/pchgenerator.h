@@ -33,7 +33,8 @@
 
 #include <QProcess>
 
-#include <queue>
+#include <algorithm>
+#include <deque>
 
 namespace ClangBackEnd {
 
@@ -73,16 +74,40 @@ unittest_public:
         process->setArguments(compilerArguments);
         process->setProgram(m_environment.clangCompilerPath());
 
+        Utils::SmallString projectPartId = projectPartPch.id().clone();
         connectProcess(processPointer, std::move(projectPartPch));
 
         if (!deferProcess())
             startProcess(std::move(process));
         else
-            m_deferredProcesses.push(std::move(process));
+            deferTask(std::move(process), std::move(projectPartId));
 
         return processPointer;
     }
 
+    void deferTask(std::unique_ptr<Process> &&process, Utils::SmallString &&projectPartId)
+    {
+        removeDeferredTask(projectPartId);
+
+        m_deferredProcesses.push_back(std::move(process));
+        m_deferredProjectPartIds.push_back(std::move(projectPartId));
+    }
+
+    void removeDeferredTask(const Utils::SmallString &projectPartId)
+    {
+        // A build which is still waiting for a free slot would only produce
+        // an outdated precompiled header, so the new task supersedes it.
+        auto found = std::find(m_deferredProjectPartIds.begin(),
+                               m_deferredProjectPartIds.end(),
+                               projectPartId);
+
+        if (found != m_deferredProjectPartIds.end()) {
+            m_deferredProcesses.erase(m_deferredProcesses.begin()
+                                      + (found - m_deferredProjectPartIds.begin()));
+            m_deferredProjectPartIds.erase(found);
+        }
+    }
+
     void connectProcess(Process *process, ProjectPartPch &&projectPartPch)
     {
         auto finishedCallback = [=,projectPartPch=std::move(projectPartPch)] (int exitCode, QProcess::ExitStatus exitStatus) {
@@ -107,7 +132,7 @@ unittest_public:
         return m_runningProcesses;
     }
 
-    const std::queue<std::unique_ptr<Process>> &deferredProcesses() const
+    const std::deque<std::unique_ptr<Process>> &deferredProcesses() const
     {
         return m_deferredProcesses;
     }
@@ -129,7 +154,8 @@ unittest_public:
     void cleanupAllProcesses()
     {
         std::vector<std::unique_ptr<Process>> runningProcesses = std::move(m_runningProcesses);
-        std::queue<std::unique_ptr<Process>> deferredProcesses = std::move(m_deferredProcesses);
+        std::deque<std::unique_ptr<Process>> deferredProcesses = std::move(m_deferredProcesses);
+        m_deferredProjectPartIds.clear();
     }
 
     static TaskFinishStatus generateTaskFinishStatus(int exitCode, QProcess::ExitStatus exitStatus)
@@ -149,7 +175,8 @@ unittest_public:
     {
         if (!m_deferredProcesses.empty()) {
             std::unique_ptr<Process> process = std::move(m_deferredProcesses.front());
-            m_deferredProcesses.pop();
+            m_deferredProcesses.pop_front();
+            m_deferredProjectPartIds.pop_front();
 
             startProcess(std::move(process));
         }
@@ -157,7 +184,8 @@ unittest_public:
 
 private:
     std::vector<std::unique_ptr<Process>> m_runningProcesses;
-    std::queue<std::unique_ptr<Process>> m_deferredProcesses;
+    std::deque<std::unique_ptr<Process>> m_deferredProcesses;
+    std::deque<Utils::SmallString> m_deferredProjectPartIds;
     Environment &m_environment;
     PchGeneratorNotifierInterface *m_notifier=nullptr;
 };
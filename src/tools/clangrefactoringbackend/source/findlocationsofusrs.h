@@ -47,6 +47,7 @@
 #    pragma warning(pop)
 #endif
 
+#include <unordered_map>
 #include <vector>
 
 namespace ClangBackEnd {
@@ -60,9 +61,7 @@ public:
     }
 
     bool VisitNamedDecl(const clang::NamedDecl *declaration) {
-        auto declarationUSR = USROfDeclaration(declaration);
-
-        if (containsUSR(declarationUSR))
+        if (matchesUSR(declaration))
             foundLocations.push_back(declaration->getLocation());
 
         return true;
@@ -72,9 +71,8 @@ public:
         const auto *declaration = expression->getFoundDecl();
 
         iterateNestedNameSpecifierLocation(expression->getQualifierLoc());
-        auto declarationUSR = USROfDeclaration(declaration);
 
-        if (containsUSR(declarationUSR))
+        if (matchesUSR(declaration))
             foundLocations.push_back(expression->getLocation());
 
         return true;
@@ -82,9 +80,8 @@ public:
 
     bool VisitMemberExpr(const clang::MemberExpr *expression) {
         const auto *declaration = expression->getFoundDecl().getDecl();
-        auto declarationUSR = USROfDeclaration(declaration);
 
-        if (containsUSR(declarationUSR))
+        if (matchesUSR(declaration))
             foundLocations.push_back(expression->getMemberLoc());
 
         return true;
@@ -103,13 +100,31 @@ private:
     void iterateNestedNameSpecifierLocation(clang::NestedNameSpecifierLoc nameLocation) {
         while (nameLocation) {
             const auto *declaration = nameLocation.getNestedNameSpecifier()->getAsNamespace();
-            if (declaration && containsUSR(USROfDeclaration(declaration)))
+            if (declaration && matchesUSR(declaration))
                 foundLocations.push_back(nameLocation.getLocalBeginLoc());
 
             nameLocation = nameLocation.getPrefix();
         }
     }
 
+    bool matchesUSR(const clang::Decl *declaration)
+    {
+        // Generating the USR builds up a string for every visited reference,
+        // which dominates the whole search. A symbol is typically referenced
+        // many times per translation unit, so remember the verdict for the
+        // canonical declaration.
+        const clang::Decl *canonicalDeclaration = declaration->getCanonicalDecl();
+
+        auto found = matchCache.find(canonicalDeclaration);
+        if (found != matchCache.end())
+            return found->second;
+
+        bool matches = containsUSR(USROfDeclaration(declaration));
+        matchCache.emplace(canonicalDeclaration, matches);
+
+        return matches;
+    }
+
     bool containsUSR(const USRName &unifiedSymbolResolution)
     {
         auto found = std::find(unifiedSymbolResolutions.cbegin(),
@@ -123,6 +138,7 @@ private:
 
     // All the locations of the USR were found.
     const std::vector<USRName> unifiedSymbolResolutions;
+    std::unordered_map<const clang::Decl*, bool> matchCache;
     std::vector<clang::SourceLocation> foundLocations;
 };
 
@@ -0,0 +1,10 @@
+TARGET = tst_bench_doxygen
+QT = core testlib
+CONFIG -= app_bundle
+
+DEFINES += CPPTOOLS_STATIC_LIBRARY
+
+SOURCES += tst_bench_doxygen.cpp \
+    ../../../src/plugins/cpptools/cppdoxygen.cpp
+
+INCLUDEPATH += ../../../src/plugins/cpptools
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt Creator.
+**
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+****************************************************************************/
+
+#include <cppdoxygen.h>
+
+#include <QString>
+#include <QStringList>
+#include <QtTest>
+
+// Benchmarks the generated doxygen tag classifier that runs inside the
+// C++ highlighter whenever a '\' or '@' prefixed word is found in a
+// doxygen comment.
+
+class BenchmarkDoxygen: public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void classifyTags();
+    void classifyIdentifiers();
+
+private:
+    static QStringList words(bool tags);
+};
+
+QStringList BenchmarkDoxygen::words(bool tags)
+{
+    QStringList result;
+    if (tags) {
+        result << QLatin1String("a") << QLatin1String("brief")
+               << QLatin1String("param") << QLatin1String("return")
+               << QLatin1String("returns") << QLatin1String("sa")
+               << QLatin1String("see") << QLatin1String("code")
+               << QLatin1String("endcode") << QLatin1String("internal")
+               << QLatin1String("note") << QLatin1String("warning")
+               << QLatin1String("addtogroup") << QLatin1String("nosubgrouping");
+    } else {
+        // plausible words following '@' or '\' that are no doxygen tags
+        result << QLatin1String("x") << QLatin1String("color")
+               << QLatin1String("QString") << QLatin1String("fileName")
+               << QLatin1String("parameter") << QLatin1String("notification")
+               << QLatin1String("extraordinarily");
+    }
+    return result;
+}
+
+void BenchmarkDoxygen::classifyTags()
+{
+    const QStringList tags = words(true);
+    QBENCHMARK {
+        foreach (const QString &tag, tags)
+            CppTools::classifyDoxygenTag(tag.unicode(), tag.size());
+    }
+}
+
+void BenchmarkDoxygen::classifyIdentifiers()
+{
+    const QStringList identifiers = words(false);
+    QBENCHMARK {
+        foreach (const QString &identifier, identifiers) {
+            QCOMPARE(CppTools::classifyDoxygenTag(identifier.unicode(), identifier.size()),
+                     int(CppTools::T_DOXY_IDENTIFIER));
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(BenchmarkDoxygen)
+
+#include "tst_bench_doxygen.moc"
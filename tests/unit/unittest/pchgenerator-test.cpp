@@ -200,6 +200,30 @@ TEST_F(PchGenerator, DoNotDeferProcess)
     ASSERT_FALSE(deferProcess);
 }
 
+TEST_F(PchGenerator, SupersedeDeferredTaskForSameProjectPart)
+{
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+
+    auto process = generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+
+    ASSERT_THAT(generator.deferredProcesses().size(), 1u);
+    ASSERT_THAT(generator.deferredProcesses().back().get(), process);
+}
+
+TEST_F(PchGenerator, DoNotSupersedeDeferredTaskForOtherProjectPart)
+{
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+    generator.addTask(compilerArguments.clone(), projectPartPch.clone());
+
+    generator.addTask(compilerArguments.clone(),
+                      ClangBackEnd::ProjectPartPch{"otherProjectPartId", "/path/to/otherpch"});
+
+    ASSERT_THAT(generator.deferredProcesses().size(), 2u);
+}
+
 TEST_F(PchGenerator, DoNotActivateIfNothingIsDeferred)
 {
     generator.activateNextDeferredProcess();
@@ -287,6 +287,28 @@ TEST_F(SqliteStatement, WriteValues)
     ASSERT_THAT(statement, HasValues("see", "7.23", 1));
 }
 
+TEST_F(SqliteStatement, WriteValuesReusesCompiledStatement)
+{
+    SqliteWriteStatement statement("UPDATE test SET name=?, number=? WHERE rowid=?", database);
+
+    statement.write("see", 7.23, 1);
+    statement.write("gloo", 1.23, 2);
+
+    ASSERT_THAT(statement, HasValues("see", "7.23", 1));
+    ASSERT_THAT(statement, HasValues("gloo", "1.23", 2));
+}
+
+TEST_F(SqliteStatement, TextViewPointsIntoColumnBuffer)
+{
+    SqliteReadStatement statement("SELECT name, number FROM test ORDER BY name", database);
+    statement.next();
+
+    statement.next();
+
+    ASSERT_THAT(statement.textView(0), Utils::SmallStringView("foo"));
+    ASSERT_THAT(statement.textView(1), Utils::SmallStringView("23.3"));
+}
+
 TEST_F(SqliteStatement, BindNamedValues)
 {
     SqliteWriteStatement statement("UPDATE test SET name=@name, number=@number WHERE rowid=@id", database);